@@ -1,44 +1,80 @@
 #include "ast.hpp"
+#include "ast_visitor.hpp"
 #include <iostream>
 #include <sstream>
 
 using namespace std;
 
-ProcedureDeclNode::~ProcedureDeclNode() {
-    for (auto p : params) delete p;
-    if (body) delete body;
-}
+static const char *const NODE_KIND_NAMES[NK_COUNT] = {
+    "Number", "Real", "String", "Char", "Boolean", "Var", "ArrayAccess",
+    "BinOp", "UnaryOp",
+    "Assign", "ProcedureCall", "If", "While", "For",
+    "ArrayType", "VarDecl", "ConstDecl", "TypeDecl", "Param", "ProcedureDecl", "FunctionDecl",
+    "Block", "Declarations", "Program"
+};
 
-FunctionDeclNode::~FunctionDeclNode() {
-    for (auto p : params) delete p;
-    if (body) delete body;
+const char *nodeKindName(NodeKind kind) {
+    return kind < NK_COUNT ? NODE_KIND_NAMES[kind] : "?";
 }
 
 // HELPER
 static string getTokenText(ParseNode* p) {
     if (!p) return "";
-    string s = p->label;
-    size_t l = s.find("(");
-    size_t r = s.find_last_of(")");
-    if (l == string::npos || r == string::npos) return s;
-    return s.substr(l + 1, r - l - 1);
+    if (p->isToken()) return string(lexeme(p->tok));
+    return nodeLabel(p);
+}
+
+// Identifiers were interned by the lexer
+static Symbol getTokenSymbol(ParseNode* p) {
+    if (p && p->isToken() && p->tok.kind == TK_IDENTIFIER) return p->tok.sym;
+    return intern(getTokenText(p));
+}
+
+// Null unless n is a block, e.g. where an error left a statement in its place
+static BlockNode* asBlock(ASTNode* n) {
+    return n && n->kind == NK_BLOCK ? static_cast<BlockNode*>(n) : nullptr;
+}
+
+static bool is(ParseNode* p, RuleKind rule) {
+    return p && p->rule == rule;
+}
+
+// Text of p's first child, e.g. an operator node's token; empty where an
+// error left p without children
+static string childText(ParseNode* p) {
+    return p && !p->children.empty() ? getTokenText(p->children[0]) : "";
+}
+
+static bool isOperatorNode(ParseNode* p) {
+    return is(p, RK_RELATIONAL_OPERATOR) || is(p, RK_ADDITIVE_OPERATOR) || is(p, RK_MULTIPLICATIVE_OPERATOR);
 }
 
-static bool has(ParseNode* p, const string& key) {
-    if (!p) return false;
-    return p->label.find(key) != string::npos;
+static bool isToken(ParseNode* p, TokenKind kind) {
+    return p && p->isToken() && p->tok.kind == kind;
 }
 
-static bool isToken(ParseNode* p, const string& prefix) {
-    if (!p) return false;
-    return p->label.rfind(prefix, 0) == 0;
+static bool isOperatorToken(ParseNode* p, Operator op) {
+    return p && p->isToken() && isOperator(p->tok, op);
 }
 
-ASTNode* convert(ParseNode* p);
+// Lowers a parse tree into nodes allocated in its arena
+struct ASTBuilder {
+    Arena &arena;
+
+    template <class T, class... Args>
+    T* make(Args&&... args) { return arena.make<T>(forward<Args>(args)...); }
+
+    ArrayTypeNode* buildArrayTypeNode(ParseNode* typeNode);
+    ASTNode* buildFactor(ParseNode* p);
+    ASTNode* buildTerm(ParseNode* p);
+    ASTNode* buildSimpleExpression(ParseNode* p);
+    ASTNode* buildExpression(ParseNode* p);
+    ASTNode* convert(ParseNode* p);
+};
 
 static bool isArrayType(ParseNode* typeNode) {
     if (!typeNode || typeNode->children.empty()) return false;
-    return has(typeNode->children[0], "<array-type>");
+    return is(typeNode->children[0], RK_ARRAY_TYPE);
 }
 
 static string getTypeName(ParseNode* typeNode) {
@@ -47,20 +83,20 @@ static string getTypeName(ParseNode* typeNode) {
     ParseNode* child = typeNode->children[0];
     
     
-    if (isToken(child, "KEYWORD")) {
+    if (isToken(child, TK_KEYWORD)) {
         return getTokenText(child);
     }
     
     // Array type: larik[...] dari <type>
-    if (has(child, "<array-type>")) {
+    if (is(child, RK_ARRAY_TYPE)) {
         string arrayType = "larik[";
         
-        if (child->children.size() > 2 && has(child->children[2], "<range>")) {
+        if (child->children.size() > 2 && is(child->children[2], RK_RANGE)) {
             ParseNode* rangeNode = child->children[2];
             if (rangeNode->children.size() >= 3) {
-                arrayType += getTokenText(rangeNode->children[0]->children[0]); // start
+                arrayType += childText(rangeNode->children[0]); // start
                 arrayType += " .. ";
-                arrayType += getTokenText(rangeNode->children[2]->children[0]); // end
+                arrayType += childText(rangeNode->children[2]); // end
             }
         }
         
@@ -76,18 +112,18 @@ static string getTypeName(ParseNode* typeNode) {
     return "";
 }
 
-static ArrayTypeNode* buildArrayTypeNode(ParseNode* typeNode) {
+ArrayTypeNode* ASTBuilder::buildArrayTypeNode(ParseNode* typeNode) {
     if (!typeNode || typeNode->children.empty()) return nullptr;
     
     ParseNode* child = typeNode->children[0];
     
-    if (!has(child, "<array-type>")) return nullptr;
+    if (!is(child, RK_ARRAY_TYPE)) return nullptr;
     
     ASTNode* rangeStart = nullptr;
     ASTNode* rangeEnd = nullptr;
     string elementType = "";
     
-    if (child->children.size() > 2 && has(child->children[2], "<range>")) {
+    if (child->children.size() > 2 && is(child->children[2], RK_RANGE)) {
         ParseNode* rangeNode = child->children[2];
         if (rangeNode->children.size() >= 3) {
             rangeStart = convert(rangeNode->children[0]);
@@ -99,125 +135,125 @@ static ArrayTypeNode* buildArrayTypeNode(ParseNode* typeNode) {
         elementType = getTypeName(child->children[5]);
     }
     
-    return new ArrayTypeNode(rangeStart, rangeEnd, elementType);
+    return make<ArrayTypeNode>(rangeStart, rangeEnd, intern(elementType));
 }
 
-ASTNode* buildFactor(ParseNode* p) {
+ASTNode* ASTBuilder::buildFactor(ParseNode* p) {
     if (!p || p->children.empty()) return nullptr;
     
     ParseNode* c = p->children[0];
 
     // NUMBER
-    if (isToken(c, "NUMBER") || isToken(c, "REAL_NUMBER")) {
+    if (isToken(c, TK_NUMBER) || isToken(c, TK_REAL_NUMBER)) {
         string val = getTokenText(c);
         if (val.find('.') != string::npos) {
-            return new RealNode(stod(val));
+            return make<RealNode>(stod(val));
         }
-        return new NumberNode(stoi(val));
+        return make<NumberNode>(stoi(val));
     }
 
     // STRING LITERAL
-    if (isToken(c, "STRING_LITERAL")) {
-        return new StringNode(getTokenText(c));
+    if (isToken(c, TK_STRING_LITERAL)) {
+        return make<StringNode>(arena.copyString(getTokenText(c)));
     }
 
     // CHAR_LITERAL
-    if (isToken(c, "CHAR_LITERAL")) {
+    if (isToken(c, TK_CHAR_LITERAL)) {
         string val = getTokenText(c);
         // Remove single quotes if present
         if (val.size() >= 3 && val.front() == '\'' && val.back() == '\'') {
-            return new CharNode(val[1]);
+            return make<CharNode>(val[1]);
         }
-        return new CharNode(val.empty() ? '\0' : val[0]);
+        return make<CharNode>(val.empty() ? '\0' : val[0]);
     }
 
     // Boolean literals (KEYWORD benar/salah)
-    if (isToken(c, "BOOLEAN")) {
+    if (isToken(c, TK_BOOLEAN)) {
         string bl = getTokenText(c);
-        if (bl == "benar") return new BoolNode(true);
-        if (bl == "salah") return new BoolNode(false);
+        if (bl == "benar") return make<BoolNode>(true);
+        if (bl == "salah") return make<BoolNode>(false);
     }
 
     // IDENTIFIER: could be variable or array access or function call
-    if (isToken(c, "IDENTIFIER")) {
-        string name = getTokenText(c);
+    if (isToken(c, TK_IDENTIFIER)) {
+        Symbol name = getTokenSymbol(c);
         
         // Check array access: IDENTIFIER [ expr ]
-        if (p->children.size() >= 4 && isToken(p->children[1], "LBRACKET")) {
+        if (p->children.size() >= 4 && isToken(p->children[1], TK_LBRACKET)) {
             ASTNode* indexExpr = convert(p->children[2]);
-            return new ArrayAccessNode(name, indexExpr);
+            return make<ArrayAccessNode>(name, indexExpr);
         }
         
         // Check function call
-        if (p->children.size() >= 2 && has(p->children[1], "<procedure/function-call>")) {
+        if (p->children.size() >= 2 && is(p->children[1], RK_CALL)) {
             return convert(p->children[1]);
         }
         
-        return new VarNode(name);
+        return make<VarNode>(name);
     }
 
     // "(" expression ")"
-    if (isToken(c, "LPARENTHESIS") && p->children.size() >= 2) {
+    if (isToken(c, TK_LPARENTHESIS) && p->children.size() >= 2) {
         return convert(p->children[1]);
     }
 
     // NOT operator (tidak)
-    if (has(c, "tidak") && p->children.size() >= 2) {
+    if (isOperatorToken(c, OP_TIDAK) && p->children.size() >= 2) {
         ASTNode* operand = convert(p->children[1]);
-        return new UnaryOpNode("not", operand);
+        return make<UnaryOpNode>(intern("not"), operand);
     }
 
     // Unary minus/plus
-    if ((c->label.find("+") != string::npos || c->label.find("-") != string::npos) && 
+    if ((isOperatorToken(c, OP_PLUS) || isOperatorToken(c, OP_MINUS)) && 
         p->children.size() >= 2) {
         string op = getTokenText(c);
         ASTNode* operand = convert(p->children[1]);
-        return new UnaryOpNode(op, operand);
+        return make<UnaryOpNode>(intern(op), operand);
     }
 
     // procedure/function call node
-    if (has(p->children[0], "<procedure/function-call>")) {
+    if (is(p->children[0], RK_CALL)) {
         return convert(p->children[0]);
     }
 
-    cerr << "Invalid factor: " << p->label << endl;
+    cerr << "Invalid factor: " << ruleName(p->rule) << endl;
     return nullptr;
 }
 
-ASTNode* buildTerm(ParseNode* p) {
+ASTNode* ASTBuilder::buildTerm(ParseNode* p) {
     if (!p || p->children.empty()) return nullptr;
     
     ASTNode* node = convert(p->children[0]);
     
     for (size_t i = 1; i + 1 < p->children.size(); i += 2) {
-        if (has(p->children[i], "operator")) {
-            string op = getTokenText(p->children[i]->children[0]);
+        if (isOperatorNode(p->children[i])) {
+            string op = childText(p->children[i]);
             ASTNode* right = convert(p->children[i + 1]);
-            node = new BinOpNode(op, node, right);
+            node = make<BinOpNode>(intern(op), node, right);
         }
     }
     
     return node;
 }
 
-ASTNode* buildSimpleExpression(ParseNode* p) {
+ASTNode* ASTBuilder::buildSimpleExpression(ParseNode* p) {
     if (!p || p->children.empty()) return nullptr;
     
     size_t idx = 0;
     
     // Check unary op di awal
-    if (has(p->children[0], "ARITHMETIC_OPERATOR")) {
+    if (isToken(p->children[0], TK_ARITHMETIC_OPERATOR)) {
         string op = getTokenText(p->children[0]);
         ASTNode* operand = convert(p->children[1]);
-        ASTNode* node = new UnaryOpNode(op, operand);
+        ASTNode* node = make<UnaryOpNode>(intern(op), operand);
         idx = 2;
         
         // binary operations
         while (idx + 1 < p->children.size()) {
-            if (has(p->children[idx], "operator")) {
-                string binOp = getTokenText(p->children[idx]->children[0]);
+            if (isOperatorNode(p->children[idx])) {
+                string binOp = childText(p->children[idx]);
                 ASTNode* right = convert(p->children[idx + 1]);
-                node = new BinOpNode(binOp, node, right);
+                node = make<BinOpNode>(intern(binOp), node, right);
                 idx += 2;
             } else {
                 break;
@@ -231,10 +267,10 @@ ASTNode* buildSimpleExpression(ParseNode* p) {
     idx = 1;
     
     while (idx + 1 < p->children.size()) {
-        if (has(p->children[idx], "operator")) {
-            string op = getTokenText(p->children[idx]->children[0]);
+        if (isOperatorNode(p->children[idx])) {
+            string op = childText(p->children[idx]);
             ASTNode* right = convert(p->children[idx + 1]);
-            node = new BinOpNode(op, node, right);
+            node = make<BinOpNode>(intern(op), node, right);
             idx += 2;
         } else {
             break;
@@ -244,7 +280,7 @@ ASTNode* buildSimpleExpression(ParseNode* p) {
     return node;
 }
 
-ASTNode* buildExpression(ParseNode* p) {
+ASTNode* ASTBuilder::buildExpression(ParseNode* p) {
     if (!p || p->children.empty()) return nullptr;
     
     if (p->children.size() == 1) {
@@ -252,96 +288,96 @@ ASTNode* buildExpression(ParseNode* p) {
     }
     
     // expression -> simple-expr relop simple-expr
-    if (p->children.size() >= 3 && has(p->children[1], "relational")) {
+    if (p->children.size() >= 3 && is(p->children[1], RK_RELATIONAL_OPERATOR)) {
         ASTNode* left = convert(p->children[0]);
-        string op = getTokenText(p->children[1]->children[0]);
+        string op = childText(p->children[1]);
         ASTNode* right = convert(p->children[2]);
-        return new BinOpNode(op, left, right);
+        return make<BinOpNode>(intern(op), left, right);
     }
     
     return convert(p->children[0]);
 }
 
-ASTNode* convert(ParseNode* p) {
+ASTNode* ASTBuilder::convert(ParseNode* p) {
     if (!p) return nullptr;
 
-    string L = p->label;
-
+    switch (p->rule) {
     // PROGRAM
-    if (has(p, "<program>")) {
-        string name = getTokenText(p->children[0]->children[1]);
-        ProgramNode* prog = new ProgramNode(name);
-        prog->declarations = new DeclarationsNode();
+    case RK_PROGRAM: {
+        Symbol name = getTokenSymbol(p->children[0]->children[1]);
+        ProgramNode* prog = make<ProgramNode>(name);
+        prog->declarations = make<DeclarationsNode>();
 
         // Parse declaration part
         if (p->children.size() > 1) {
             ParseNode* declPart = p->children[1];
+            vector<ASTNode*> decls;
             
             for (auto c : declPart->children) {
-                if (has(c, "<var-declaration>")) {
+                if (is(c, RK_VAR_DECLARATION)) {
                    
-                    vector<string> currentVarNames;
+                    vector<Symbol> currentVarNames;
                     
                     for (size_t i = 0; i < c->children.size(); i++) {
                         auto cc = c->children[i];
                         
-                        if (has(cc, "<identifier-list>")) {
+                        if (is(cc, RK_IDENTIFIER_LIST)) {
                             currentVarNames.clear();
                             for (auto id : cc->children) {
-                                if (isToken(id, "IDENTIFIER")) {
-                                    currentVarNames.push_back(getTokenText(id));
+                                if (isToken(id, TK_IDENTIFIER)) {
+                                    currentVarNames.push_back(getTokenSymbol(id));
                                 }
                             }
                         }
-                        else if (has(cc, "<type>")) {
-                            for (const string& varName : currentVarNames) {
-                                VarDeclNode* v = new VarDeclNode();
-                                v->names.push_back(varName);
+                        else if (is(cc, RK_TYPE)) {
+                            for (Symbol varName : currentVarNames) {
+                                VarDeclNode* v = make<VarDeclNode>();
+                                v->names = Span<Symbol>{arena.copyArray(&varName, 1), 1};
                                 
                                 // Check if array type
                                 if (isArrayType(cc)) {
                                     v->arrayType = buildArrayTypeNode(cc);
-                                    v->typeName = ""; 
+                                    v->typeName = Symbol(); 
                                 } else {
-                                    v->typeName = getTypeName(cc);
+                                    v->typeName = intern(getTypeName(cc));
                                     v->arrayType = nullptr;
                                 }
                                 
-                                prog->declarations->declarations.push_back(v);
+                                decls.push_back(v);
                             }
                             
                             currentVarNames.clear();
                         }
                     }
                 }
-                else if (has(c, "<const-declaration>")) {
+                else if (is(c, RK_CONST_DECLARATION)) {
                     // Parse const declarations
                     for (size_t i = 1; i < c->children.size(); ) {
-                        if (isToken(c->children[i], "IDENTIFIER")) {
-                            string constName = getTokenText(c->children[i]);
+                        if (isToken(c->children[i], TK_IDENTIFIER)) {
+                            Symbol constName = getTokenSymbol(c->children[i]);
                             ASTNode* constValue = nullptr;
                             
                             if (i + 2 < c->children.size()) {
                                 ParseNode* valNode = c->children[i + 2];
-                                if (isToken(valNode, "NUMBER")) {
+                                if (isToken(valNode, TK_NUMBER)) {
                                     string val = getTokenText(valNode);
                                     if (val.find('.') != string::npos) {
-                                        constValue = new RealNode(stod(val));
+                                        constValue = make<RealNode>(stod(val));
                                     } else {
-                                        constValue = new NumberNode(stoi(val));
+                                        constValue = make<NumberNode>(stoi(val));
                                     }
-                                } else if (isToken(valNode, "STRING_LITERAL")) {
-                                    constValue = new StringNode(getTokenText(valNode));
-                                } else if (isToken(valNode, "CHAR_LITERAL")) {
+                                } else if (isToken(valNode, TK_STRING_LITERAL)) {
+                                    constValue = make<StringNode>(arena.copyString(getTokenText(valNode)));
+                                } else if (isToken(valNode, TK_CHAR_LITERAL)) {
                                     string v = getTokenText(valNode);
-                                    constValue = new CharNode(v.empty() ? '\0' : v[0]);
-                                } else if (isToken(valNode, "IDENTIFIER")) {
-                                    constValue = new VarNode(getTokenText(valNode));
+                                    constValue = make<CharNode>(v.empty() ? '\0' : v[0]);
+                                } else if (isToken(valNode, TK_IDENTIFIER)) {
+                                    constValue = make<VarNode>(getTokenSymbol(valNode));
                                 }
                             }
                             
                             if (constValue) {
-                                prog->declarations->declarations.push_back(new ConstDeclNode(constName, constValue));
+                                decls.push_back(make<ConstDeclNode>(constName, constValue));
                             }
                             
                             i += 4; // IDENTIFIER := value SEMICOLON
@@ -350,56 +386,57 @@ ASTNode* convert(ParseNode* p) {
                         }
                     }
                 }
-                else if (has(c, "<type-declaration>")) {
+                else if (is(c, RK_TYPE_DECLARATION)) {
                     // Parse tipe declarations
                     for (size_t i = 1; i < c->children.size(); ) {
-                        if (isToken(c->children[i], "IDENTIFIER")) {
-                            string typeName = getTokenText(c->children[i]);
-                            TypeDeclNode* typeDecl = new TypeDeclNode(typeName, "");
+                        if (isToken(c->children[i], TK_IDENTIFIER)) {
+                            Symbol typeName = getTokenSymbol(c->children[i]);
+                            TypeDeclNode* typeDecl = make<TypeDeclNode>(typeName);
                             
-                            if (i + 2 < c->children.size() && has(c->children[i + 2], "<type-definition>")) {
+                            if (i + 2 < c->children.size() && is(c->children[i + 2], RK_TYPE_DEFINITION)) {
                                 ParseNode* defNode = c->children[i + 2];
                                 if (!defNode->children.empty()) {
                                     ParseNode* typeNode = defNode->children[0];
                                     
-                                    if (has(typeNode, "<type>")) {
+                                    if (is(typeNode, RK_TYPE)) {
                                         if (isArrayType(typeNode)) {
                                             typeDecl->arrayType = buildArrayTypeNode(typeNode);
                                         } else {
-                                            typeDecl->definition = getTypeName(typeNode);
+                                            typeDecl->definition = intern(getTypeName(typeNode));
                                         }
                                     } else {
-                                        typeDecl->definition = getTokenText(typeNode);
+                                        typeDecl->definition = intern(getTokenText(typeNode));
                                     }
                                 }
                             }
                             
-                            prog->declarations->declarations.push_back(typeDecl);
+                            decls.push_back(typeDecl);
                             i += 4; // IDENTIFIER := type-definition SEMICOLON
                         } else {
                             i++;
                         }
                     }
                 }
-                else if (has(c, "<subprogram-declaration>")) {
+                else if (is(c, RK_SUBPROGRAM_DECLARATION)) {
                     ASTNode* subprog = convert(c);
                     if (subprog) {
-                        prog->declarations->declarations.push_back(subprog);
+                        decls.push_back(subprog);
                     }
                 }
             }
+            prog->declarations->declarations = arena.copySpan(decls);
         }
 
         // Parse compound statement (main block)
         if (p->children.size() > 2) {
-            prog->block = dynamic_cast<BlockNode*>(convert(p->children[2]));
+            prog->block = asBlock(convert(p->children[2]));
         }
 
         return prog;
     }
 
     // SUBPROGRAM DECLARATION
-    if (has(p, "<subprogram-declaration>")) {
+    case RK_SUBPROGRAM_DECLARATION: {
         if (!p->children.empty()) {
             return convert(p->children[0]);
         }
@@ -407,146 +444,154 @@ ASTNode* convert(ParseNode* p) {
     }
 
     // PROCEDURE DECLARATION
-    if (has(p, "<procedure-declaration>")) {
-        string procName = getTokenText(p->children[1]);
-        ProcedureDeclNode* proc = new ProcedureDeclNode(procName);
+    case RK_PROCEDURE_DECLARATION: {
+        Symbol procName = getTokenSymbol(p->children[1]);
+        ProcedureDeclNode* proc = make<ProcedureDeclNode>(procName);
         
         // Parse parameters
         size_t blockIdx = 3; // Default: prosedur ID ; block ;
-        if (p->children.size() > 3 && has(p->children[2], "<formal-parameter-list>")) {
+        if (p->children.size() > 3 && is(p->children[2], RK_FORMAL_PARAMETER_LIST)) {
             ParseNode* paramList = p->children[2];
+            vector<ParamNode*> params;
             // Parse parameter groups
             for (auto child : paramList->children) {
-                if (has(child, "<parameter-group>")) {
-                    ParamNode* param = new ParamNode();
+                if (is(child, RK_PARAMETER_GROUP)) {
+                    ParamNode* param = make<ParamNode>();
                     for (auto pc : child->children) {
-                        if (has(pc, "<identifier-list>")) {
+                        if (is(pc, RK_IDENTIFIER_LIST)) {
+                            vector<Symbol> names;
                             for (auto id : pc->children) {
-                                if (isToken(id, "IDENTIFIER")) {
-                                    param->names.push_back(getTokenText(id));
+                                if (isToken(id, TK_IDENTIFIER)) {
+                                    names.push_back(getTokenSymbol(id));
                                 }
                             }
+                            param->names = arena.copySpan(names);
                         }
-                        else if (has(pc, "<type>")) {
+                        else if (is(pc, RK_TYPE)) {
                             if (!pc->children.empty()) {
-                                param->typeName = getTokenText(pc->children[0]);
+                                param->typeName = intern(getTokenText(pc->children[0]));
                             }
                         }
                     }
-                    proc->params.push_back(param);
+                    params.push_back(param);
                 }
             }
+            proc->params = arena.copySpan(params);
             blockIdx = 4; // prosedur ID (params) ; block ;
         }
         
         // Parse block
         if (blockIdx < p->children.size()) {
-            proc->body = dynamic_cast<BlockNode*>(convert(p->children[blockIdx]));
+            proc->body = asBlock(convert(p->children[blockIdx]));
         }
         
         return proc;
     }
 
     // FUNCTION DECLARATION
-    if (has(p, "<function-declaration>")) {
-        string funcName = getTokenText(p->children[1]);
+    case RK_FUNCTION_DECLARATION: {
+        Symbol funcName = getTokenSymbol(p->children[1]);
         string returnType = "";
         
         // Find return type
         size_t blockIdx = 6; // Default: fungsi ID : type ; block ;
         for (size_t i = 0; i < p->children.size(); i++) {
-            if (has(p->children[i], "<type>")) {
+            if (is(p->children[i], RK_TYPE)) {
                 if (!p->children[i]->children.empty()) {
-                    returnType = getTokenText(p->children[i]->children[0]);
+                    returnType = childText(p->children[i]);
                 }
                 break;
             }
         }
         
-        FunctionDeclNode* func = new FunctionDeclNode(funcName, returnType);
+        FunctionDeclNode* func = make<FunctionDeclNode>(funcName, intern(returnType));
         
         // Parse parameters
-        if (p->children.size() > 3 && has(p->children[2], "<formal-parameter-list>")) {
+        if (p->children.size() > 3 && is(p->children[2], RK_FORMAL_PARAMETER_LIST)) {
             ParseNode* paramList = p->children[2];
+            vector<ParamNode*> params;
             for (auto child : paramList->children) {
-                if (has(child, "<parameter-group>")) {
-                    ParamNode* param = new ParamNode();
+                if (is(child, RK_PARAMETER_GROUP)) {
+                    ParamNode* param = make<ParamNode>();
                     for (auto pc : child->children) {
-                        if (has(pc, "<identifier-list>")) {
+                        if (is(pc, RK_IDENTIFIER_LIST)) {
+                            vector<Symbol> names;
                             for (auto id : pc->children) {
-                                if (isToken(id, "IDENTIFIER")) {
-                                    param->names.push_back(getTokenText(id));
+                                if (isToken(id, TK_IDENTIFIER)) {
+                                    names.push_back(getTokenSymbol(id));
                                 }
                             }
+                            param->names = arena.copySpan(names);
                         }
-                        else if (has(pc, "<type>")) {
+                        else if (is(pc, RK_TYPE)) {
                             if (!pc->children.empty()) {
-                                param->typeName = getTokenText(pc->children[0]);
+                                param->typeName = intern(getTokenText(pc->children[0]));
                             }
                         }
                     }
-                    func->params.push_back(param);
+                    params.push_back(param);
                 }
             }
+            func->params = arena.copySpan(params);
             blockIdx = 7; // fungsi ID (params) : type ; block ;
         }
         
         // Parse block
         if (blockIdx < p->children.size()) {
-            func->body = dynamic_cast<BlockNode*>(convert(p->children[blockIdx]));
+            func->body = asBlock(convert(p->children[blockIdx]));
         }
         
         return func;
     }
 
     // BLOCK
-    if (has(p, "<block>")) {
-        BlockNode* block = new BlockNode();
+    case RK_BLOCK: {
+        BlockNode* block = make<BlockNode>();
+        vector<ASTNode*> decls;
         
         for (auto child : p->children) {
             // if (!child) continue;
-            if (has(child, "<declaration-part>")) {
+            if (is(child, RK_DECLARATION_PART)) {
                 // Parse declarations
                 for (auto decl : child->children) {
-                    if (has(decl, "<var-declaration>")) {
-                        cerr << "[DEBUG] Processing var-declaration" << endl;
+                    if (is(decl, RK_VAR_DECLARATION)) {
                         // Parse variable declarations
-                        vector<string> currentVarNames;
+                        vector<Symbol> currentVarNames;
                         
                         for (size_t i = 0; i < decl->children.size(); i++) {
                             auto cc = decl->children[i];
                             if (!cc) continue;
                             
-                            if (has(cc, "<identifier-list>")) {
+                            if (is(cc, RK_IDENTIFIER_LIST)) {
                                 currentVarNames.clear();
                                 for (auto id : cc->children) {
-                                    if (id && isToken(id, "IDENTIFIER")) {
-                                        currentVarNames.push_back(getTokenText(id));
+                                    if (id && isToken(id, TK_IDENTIFIER)) {
+                                        currentVarNames.push_back(getTokenSymbol(id));
                                     }
                                 }
                             }
-                            else if (has(cc, "<type>")) {
-                                for (const string& varName : currentVarNames) {
-                                    VarDeclNode* v = new VarDeclNode();
-                                    v->names.push_back(varName);
+                            else if (is(cc, RK_TYPE)) {
+                                for (Symbol varName : currentVarNames) {
+                                    VarDeclNode* v = make<VarDeclNode>();
+                                    v->names = Span<Symbol>{arena.copyArray(&varName, 1), 1};
                                     
                                     // Check if array type
                                     if (isArrayType(cc)) {
                                         v->arrayType = buildArrayTypeNode(cc);
-                                        v->typeName = ""; 
+                                        v->typeName = Symbol(); 
                                     } else {
                               
-                                        v->typeName = getTypeName(cc);
+                                        v->typeName = intern(getTypeName(cc));
                                         v->arrayType = nullptr;
                                     }
                                     
-                                    block->declarations.push_back(v);
+                                    decls.push_back(v);
                                 }
                                 currentVarNames.clear();
                             }
                         }
                     }
-                    else if (has(decl, "<const-declaration>")) {
+                    else if (is(decl, RK_CONST_DECLARATION)) {
                         for (size_t i = 1; i < decl->children.size(); ) {
                             if (i >= decl->children.size()) break;
                             
@@ -556,7 +601,7 @@ ASTNode* convert(ParseNode* p) {
                                 continue;
                             }
                             
-                            if (isToken(current, "IDENTIFIER")) {
+                            if (isToken(current, TK_IDENTIFIER)) {
                         
                                 if (i + 3 >= decl->children.size()) {
                                     i++; 
@@ -568,14 +613,14 @@ ASTNode* convert(ParseNode* p) {
                                 ParseNode* semicolon = decl->children[i + 3];
                                 
                          
-                                if (assignOp && isToken(assignOp, "ASSIGN_OPERATOR") &&
-                                    valueNode && semicolon && isToken(semicolon, "SEMICOLON")) {
+                                if (assignOp && isToken(assignOp, TK_ASSIGN_OPERATOR) &&
+                                    valueNode && semicolon && isToken(semicolon, TK_SEMICOLON)) {
                                     
-                                    string constName = getTokenText(current);
+                                    Symbol constName = getTokenSymbol(current);
                                     ASTNode* constValue = convert(valueNode);
                                     
                                     if (constValue) {
-                                        block->declarations.push_back(new ConstDeclNode(constName, constValue));
+                                        decls.push_back(make<ConstDeclNode>(constName, constValue));
                                     }
                                     
                                     i += 4; 
@@ -587,7 +632,7 @@ ASTNode* convert(ParseNode* p) {
                             }
                         }
                     }
-                    else if (has(decl, "<type-declaration>")) {
+                    else if (is(decl, RK_TYPE_DECLARATION)) {
                      
                         for (size_t i = 1; i < decl->children.size(); ) {
                             if (i >= decl->children.size()) break;
@@ -598,7 +643,7 @@ ASTNode* convert(ParseNode* p) {
                                 continue;
                             }
                             
-                            if (isToken(current, "IDENTIFIER")) {
+                            if (isToken(current, TK_IDENTIFIER)) {
                           
                                 if (i + 3 >= decl->children.size()) {
                                     i++;
@@ -609,29 +654,29 @@ ASTNode* convert(ParseNode* p) {
                                 ParseNode* typeDefNode = decl->children[i + 2];
                                 ParseNode* semicolon = decl->children[i + 3];
                                 
-                                if (assignOp && isToken(assignOp, "ASSIGN_OPERATOR") &&
-                                    typeDefNode && has(typeDefNode, "<type-definition>") &&
-                                    semicolon && isToken(semicolon, "SEMICOLON")) {
+                                if (assignOp && isToken(assignOp, TK_ASSIGN_OPERATOR) &&
+                                    typeDefNode && is(typeDefNode, RK_TYPE_DEFINITION) &&
+                                    semicolon && isToken(semicolon, TK_SEMICOLON)) {
                                     
-                                    string typeName = getTokenText(current);
-                                    TypeDeclNode* typeDecl = new TypeDeclNode(typeName, "");
+                                    Symbol typeName = getTokenSymbol(current);
+                                    TypeDeclNode* typeDecl = make<TypeDeclNode>(typeName);
                                     
                                     if (!typeDefNode->children.empty()) {
                                         ParseNode* typeNode = typeDefNode->children[0];
                                         if (typeNode) {
-                                            if (has(typeNode, "<type>")) {
+                                            if (is(typeNode, RK_TYPE)) {
                                                 if (isArrayType(typeNode)) {
                                                     typeDecl->arrayType = buildArrayTypeNode(typeNode);
                                                 } else {
-                                                    typeDecl->definition = getTypeName(typeNode);
+                                                    typeDecl->definition = intern(getTypeName(typeNode));
                                                 }
                                             } else {
-                                                typeDecl->definition = getTokenText(typeNode);
+                                                typeDecl->definition = intern(getTokenText(typeNode));
                                             }
                                         }
                                     }
                                     
-                                    block->declarations.push_back(typeDecl);
+                                    decls.push_back(typeDecl);
                                     i += 4;
                                 } else {
                                     i++;
@@ -643,63 +688,64 @@ ASTNode* convert(ParseNode* p) {
                     }
                 }
             }
-            else if (has(child, "<compound-statement>")) {
+            else if (is(child, RK_COMPOUND_STATEMENT)) {
                 // Parse statements
-                BlockNode* stmtBlock = dynamic_cast<BlockNode*>(convert(child));
+                BlockNode* stmtBlock = asBlock(convert(child));
                 if (stmtBlock) {
                     block->statements = stmtBlock->statements;
-                    stmtBlock->statements.clear(); // Prevent double delete
-                    delete stmtBlock;
                 }
             }
         }
+        block->declarations = arena.copySpan(decls);
         
         return block;
     }
 
     // COMPOUND STATEMENT
-    if (has(p, "<compound-statement>")) {
-        BlockNode* block = new BlockNode();
+    case RK_COMPOUND_STATEMENT: {
+        BlockNode* block = make<BlockNode>();
+        vector<ASTNode*> stmts;
         
         // statement-list
         for (auto child : p->children) {
-            if (has(child, "<statement-list>")) {
+            if (is(child, RK_STATEMENT_LIST)) {
                 for (auto s : child->children) {
-                    if (has(s, "<statement>")) {
+                    if (is(s, RK_STATEMENT)) {
                         if (!s->children.empty()) {
                             ASTNode* stmt = convert(s->children[0]);
-                            if (stmt) block->statements.push_back(stmt);
+                            if (stmt) stmts.push_back(stmt);
                         }
                     }
                 }
             }
         }
+        block->statements = arena.copySpan(stmts);
         
         return block;
     }
 
     // ASSIGNMENT
-    if (has(p, "<assignment-statement>")) {
+    case RK_ASSIGNMENT_STATEMENT: {
         ASTNode* target = nullptr;
         ASTNode* value = nullptr;
         
-        string varName = getTokenText(p->children[0]);
+        Symbol varName = getTokenSymbol(p->children[0]);
         
         // Check for array access
-        if (p->children.size() >= 4 && isToken(p->children[1], "LBRACKET")) {
+        if (p->children.size() >= 4 && isToken(p->children[1], TK_LBRACKET)) {
             ASTNode* index = convert(p->children[2]);
-            target = new ArrayAccessNode(varName, index);
+            target = make<ArrayAccessNode>(varName, index);
             value = convert(p->children.back());
         } else {
-            target = new VarNode(varName);
+            target = make<VarNode>(varName);
             value = convert(p->children.back());
         }
         
-        return new AssignNode(target, value);
+        return make<AssignNode>(target, value);
     }
 
     // IF STATEMENT
-    if (has(p, "<if-statement>")) {
+    case RK_IF_STATEMENT: {
         ASTNode* condition = nullptr;
         ASTNode* thenBranch = nullptr;
         ASTNode* elseBranch = nullptr;
@@ -707,77 +753,77 @@ ASTNode* convert(ParseNode* p) {
         size_t idx = 0;
         
         // "jika"
-        if (idx < p->children.size() && isToken(p->children[idx], "KEYWORD")) {
+        if (idx < p->children.size() && isToken(p->children[idx], TK_KEYWORD)) {
             idx++;
         }
         
         // condition exp
-        if (idx < p->children.size() && has(p->children[idx], "<expression>")) {
+        if (idx < p->children.size() && is(p->children[idx], RK_EXPRESSION)) {
             condition = convert(p->children[idx]);
             idx++;
         }
         
         // "maka"
-        if (idx < p->children.size() && isToken(p->children[idx], "KEYWORD")) {
+        if (idx < p->children.size() && isToken(p->children[idx], TK_KEYWORD)) {
             idx++;
         }
         
         // then
-        if (idx < p->children.size() && has(p->children[idx], "<statement>")) {
+        if (idx < p->children.size() && is(p->children[idx], RK_STATEMENT)) {
             thenBranch = convert(p->children[idx]);
             idx++;
         }
         
         // else
-        if (idx < p->children.size() && isToken(p->children[idx], "SEMICOLON")) {
+        if (idx < p->children.size() && isToken(p->children[idx], TK_SEMICOLON)) {
             idx++;
         }
         
-        if (idx < p->children.size() && isToken(p->children[idx], "KEYWORD")) {
+        if (idx < p->children.size() && isToken(p->children[idx], TK_KEYWORD)) {
             string kw = getTokenText(p->children[idx]);
             if (kw == "selain-itu") {
                 idx++;
-                if (idx < p->children.size() && has(p->children[idx], "<statement>")) {
+                if (idx < p->children.size() && is(p->children[idx], RK_STATEMENT)) {
                     elseBranch = convert(p->children[idx]);
                 }
             }
         }
         
-        return new IfNode(condition, thenBranch, elseBranch);
+        return make<IfNode>(condition, thenBranch, elseBranch);
     }
 
     // WHILE STATEMENT
-    if (has(p, "<while-statement>")) {
+    case RK_WHILE_STATEMENT: {
         ASTNode* condition = nullptr;
         ASTNode* body = nullptr;
         
         size_t idx = 0;
         
         // "selama"
-        if (idx < p->children.size() && isToken(p->children[idx], "KEYWORD")) {
+        if (idx < p->children.size() && isToken(p->children[idx], TK_KEYWORD)) {
             idx++;
         }
         
-        if (idx < p->children.size() && has(p->children[idx], "<expression>")) {
+        if (idx < p->children.size() && is(p->children[idx], RK_EXPRESSION)) {
             condition = convert(p->children[idx]);
             idx++;
         }
         
         // "lakukan"
-        if (idx < p->children.size() && isToken(p->children[idx], "KEYWORD")) {
+        if (idx < p->children.size() && isToken(p->children[idx], TK_KEYWORD)) {
             idx++;
         }
         
         // compound-statement
-        if (idx < p->children.size() && has(p->children[idx], "<compound-statement>")) {
+        if (idx < p->children.size() && is(p->children[idx], RK_COMPOUND_STATEMENT)) {
             body = convert(p->children[idx]);
         }
         
-        return new WhileNode(condition, body);
+        return make<WhileNode>(condition, body);
     }
 
     // FOR STATEMENT
-    if (has(p, "<for-statement>")) {
+    case RK_FOR_STATEMENT: {
         ASTNode* counterNode = nullptr;
         ASTNode* start = nullptr;
         ASTNode* end = nullptr;
@@ -787,28 +833,28 @@ ASTNode* convert(ParseNode* p) {
         size_t idx = 0;
         
         // "untuk"
-        if (idx < p->children.size() && isToken(p->children[idx], "KEYWORD")) {
+        if (idx < p->children.size() && isToken(p->children[idx], TK_KEYWORD)) {
             idx++;
         }
         
-        if (idx < p->children.size() && isToken(p->children[idx], "IDENTIFIER")) {
-            string counterName = getTokenText(p->children[idx]);
-            counterNode = new VarNode(counterName);
+        if (idx < p->children.size() && isToken(p->children[idx], TK_IDENTIFIER)) {
+            Symbol counterName = getTokenSymbol(p->children[idx]);
+            counterNode = make<VarNode>(counterName);
             idx++;
         }
         
         // ":=" 
-        if (idx < p->children.size() && isToken(p->children[idx], "ASSIGN_OPERATOR")) {
+        if (idx < p->children.size() && isToken(p->children[idx], TK_ASSIGN_OPERATOR)) {
             idx++;
         }
         
-        if (idx < p->children.size() && has(p->children[idx], "<expression>")) {
+        if (idx < p->children.size() && is(p->children[idx], RK_EXPRESSION)) {
             start = convert(p->children[idx]);
             idx++;
         }
         
         // Check "ke" or "turun-ke"
-        if (idx < p->children.size() && isToken(p->children[idx], "KEYWORD")) {
+        if (idx < p->children.size() && isToken(p->children[idx], TK_KEYWORD)) {
             string kw = getTokenText(p->children[idx]);
             if (kw == "turun-ke") {
                 ascending = false;
@@ -816,163 +862,207 @@ ASTNode* convert(ParseNode* p) {
             idx++;
         }
         
-        if (idx < p->children.size() && has(p->children[idx], "<expression>")) {
+        if (idx < p->children.size() && is(p->children[idx], RK_EXPRESSION)) {
             end = convert(p->children[idx]);
             idx++;
         }
         
         // "lakukan"
-        if (idx < p->children.size() && isToken(p->children[idx], "KEYWORD")) {
+        if (idx < p->children.size() && isToken(p->children[idx], TK_KEYWORD)) {
             idx++;
         }
         
-        if (idx < p->children.size() && has(p->children[idx], "<compound-statement>")) {
+        if (idx < p->children.size() && is(p->children[idx], RK_COMPOUND_STATEMENT)) {
             body = convert(p->children[idx]);
         }
         
-        return new ForNode(counterNode, start, end, body, ascending);
+        return make<ForNode>(counterNode, start, end, body, ascending);
     }
 
     // PROCEDURE/FUNCTION CALL
-    if (has(p, "<procedure/function-call>")) {
+    case RK_CALL: {
         if (p->children.empty()) return nullptr;
         
-        string name = getTokenText(p->children[0]);
-        ProcedureCallNode* call = new ProcedureCallNode(name);
+        Symbol name = getTokenSymbol(p->children[0]);
+        ProcedureCallNode* call = make<ProcedureCallNode>(name);
+        vector<ASTNode*> args;
         
         // Parse arguments
         for (auto child : p->children) {
-            if (has(child, "<parameter-list>")) {
+            if (is(child, RK_PARAMETER_LIST)) {
                 for (auto param : child->children) {
-                    if (has(param, "<expression>")) {
+                    if (is(param, RK_EXPRESSION)) {
                         ASTNode* arg = convert(param);
-                        if (arg) call->args.push_back(arg);
+                        if (arg) args.push_back(arg);
                     }
                 }
             }
         }
+        call->args = arena.copySpan(args);
         
         return call;
     }
 
     // EXPRESSIONS
-    if (has(p, "<expression>")) return buildExpression(p);
-    if (has(p, "<simple-expression>")) return buildSimpleExpression(p);
-    if (has(p, "<term>")) return buildTerm(p);
-    if (has(p, "<factor>")) return buildFactor(p);
+    case RK_EXPRESSION: return buildExpression(p);
+    case RK_SIMPLE_EXPRESSION: return buildSimpleExpression(p);
+    case RK_TERM: return buildTerm(p);
+    case RK_FACTOR: return buildFactor(p);
 
-    if (has(p, "<statement>")) {
+    case RK_STATEMENT: {
         if (p->children.empty()) return nullptr;
         return convert(p->children[0]);
     }
 
     // Defaultnya try to convert first child
-    if (!p->children.empty()) {
-        return convert(p->children[0]);
+    default:
+        if (!p->children.empty()) {
+            return convert(p->children[0]);
+        }
+        return nullptr;
     }
-
-    return nullptr;
 }
 
-void printAST(ASTNode* node, const string& prefix, bool isLast) {
-    if (!node) return;
-    
-    cout << prefix;
-    cout << (isLast ? "└── " : "├── ");
-    
-    cout << node->nodeType;
-    
-    if (node->nodeType == "Number") {
-        cout << "(" << static_cast<NumberNode*>(node)->value << ")";
-    }
-    else if (node->nodeType == "Real") {
-        cout << "(" << static_cast<RealNode*>(node)->value << ")";
+// Tree printer behind printAST. Most children sit under a label ("left: ",
+// "body: "); a leaf of the kinds its label allows goes on the label's own
+// line instead, e.g. "└── left: Var(x)".
+class ASTPrinter : public ASTTreePrinter<ASTPrinter> {
+public:
+    using ASTTreePrinter<ASTPrinter>::ASTTreePrinter;
+    using ASTTreePrinter<ASTPrinter>::walkChildren;
+
+    template <class T>
+    bool enter(T* node) {
+        if (!inlined) line();
+        cout << nodeKindName(node->kind);
+        describe(node);
+        if (inlined) return false;
+        cout << endl;
+        return true;
     }
-    else if (node->nodeType == "String") {
-        cout << "(\"" << static_cast<StringNode*>(node)->value << "\"" << ")";
+
+    void walkChildren(ConstDeclNode*) {}        // the value is on the declaration's line
+
+    void walkChildren(AssignNode* node) {
+        if (node->target && node->target->kind == NK_ARRAY_ACCESS) {
+            // The index goes straight under the label
+            bool last = !node->value;
+            cout << prefix << indent() << (last ? "└── " : "├── ") << "target: ";
+            inlineLeaf(node->target);
+            cout << endl;
+            nest(static_cast<ArrayAccessNode*>(node->target)->index, true, last ? "    " : "│   ");
+        } else {
+            labeled("target", node->target, !node->value, {NK_VAR});
+        }
+        labeled("value", node->value, true, {NK_NUMBER, NK_REAL, NK_STRING, NK_CHAR, NK_BOOLEAN, NK_VAR});
     }
-    else if (node->nodeType == "Char") {
-        cout << "('" << static_cast<CharNode*>(node)->value << "'" << ")";
+
+    // labeled() for both operands, split around the left one (see ASTVisitor)
+    bool walkLeft(BinOpNode* node) {
+        return openLabel("left", node->left, !node->right, {NK_NUMBER, NK_VAR});
     }
-    else if (node->nodeType == "Boolean") {
-        cout << "(" << (static_cast<BoolNode*>(node)->value ? "true" : "false") << ")";
+
+    void walkRight(BinOpNode* node) {
+        close();
+        labeled("right", node->right, true, {NK_NUMBER, NK_VAR});
     }
-    else if (node->nodeType == "Var") {
-        cout << "(" << static_cast<VarNode*>(node)->name << ")";
+
+    void walkChildren(UnaryOpNode* node) {
+        labeled("operand", node->operand, true, {NK_NUMBER, NK_VAR});
     }
-    else if (node->nodeType == "ArrayAccess") {
-        cout << ": " << static_cast<ArrayAccessNode*>(node)->arrayName;
+
+    void walkChildren(ArrayAccessNode* node) {
+        labeled("index", node->index, true, {NK_NUMBER, NK_VAR});
     }
-    else if (node->nodeType == "BinOp") {
-        cout << "(" << static_cast<BinOpNode*>(node)->op << ")";
+
+    void walkChildren(IfNode* node) {
+        size_t total = (node->condition != nullptr) + (node->thenBranch != nullptr) + (node->elseBranch != nullptr);
+        size_t count = 0;
+        if (node->condition) labeled("condition", node->condition, ++count == total);
+        if (node->thenBranch) labeled("thenBranch", node->thenBranch, ++count == total);
+        if (node->elseBranch) labeled("elseBranch", node->elseBranch, ++count == total);
     }
-    else if (node->nodeType == "UnaryOp") {
-        cout << "(" << static_cast<UnaryOpNode*>(node)->op << ")";
+
+    void walkChildren(WhileNode* node) {
+        labeled("condition", node->condition, !node->body);
+        labeled("body", node->body, true);
     }
-    else if (node->nodeType == "Program") {
-        cout << "(name: " << static_cast<ProgramNode*>(node)->name << ")";
+
+    void walkChildren(ForNode* node) {
+        // ascending always comes last
+        labeled("counter", node->counter, false, {NK_VAR});
+        labeled("start", node->start, false);
+        labeled("end", node->end, false);
+        labeled("body", node->body, false);
+        cout << prefix << indent() << "└── ascending: " << (node->ascending ? "true" : "false") << endl;
     }
-    else if (node->nodeType == "VarDecl") {
-        VarDeclNode* vd = static_cast<VarDeclNode*>(node);
-        cout << "(name: '" << vd->names[0] << "', type: ";
-        if (vd->arrayType) {
-            cout << "ArrayType)";
-        } else {
-            cout << "'" << vd->typeName << "')";
+
+    void walkChildren(ProcedureCallNode* node) {
+        for (size_t i = 0; i < node->args.size(); i++) {
+            labeled("arg", node->args[i], i + 1 == node->args.size(),
+                    {NK_NUMBER, NK_VAR, NK_STRING, NK_BOOLEAN}, false);
         }
     }
-    else if (node->nodeType == "ConstDecl") {
-        ConstDeclNode* cd = static_cast<ConstDeclNode*>(node);
-        cout << " (name: " << cd->name << ", value: ";
-        
-        if (cd->value) {
-            cout << cd->value->nodeType << "(";
-            if (cd->value->nodeType == "Number") {
-                cout << static_cast<NumberNode*>(cd->value)->value;
-            } else if (cd->value->nodeType == "Real") {
-                cout << static_cast<RealNode*>(cd->value)->value;
-            } else if (cd->value->nodeType == "String") {
-                cout << "\"" << static_cast<StringNode*>(cd->value)->value << "\"";
-            } else if (cd->value->nodeType == "Char") {
-                cout << "'" << static_cast<CharNode*>(cd->value)->value << "'";
-            } else if (cd->value->nodeType == "Boolean") {
-                cout << (static_cast<BoolNode*>(cd->value)->value ? "true" : "false");
+
+    void walkChildren(ArrayTypeNode* node) {
+        size_t total = (node->rangeStart != nullptr) + (node->rangeEnd != nullptr);
+        size_t count = 0;
+        if (node->rangeStart) bound("startRange", node->rangeStart, ++count == total);
+        if (node->rangeEnd) bound("endRange", node->rangeEnd, ++count == total);
+    }
+
+private:
+    // "label: " under the current node, then child on the same line if it
+    // is one of inlineKinds, else as a subtree below
+    void labeled(const char* label, ASTNode* child, bool last,
+                 initializer_list<NodeKind> inlineKinds = {}, bool quoteInline = true) {
+        if (openLabel(label, child, last, inlineKinds, quoteInline)) this->walk(child);
+        close();
+    }
+
+    // labeled() up to walking child: true if child goes below, in which
+    // case the level for it is open. close() follows either way.
+    bool openLabel(const char* label, ASTNode* child, bool last,
+                   initializer_list<NodeKind> inlineKinds = {}, bool quoteInline = true) {
+        bool below = child != nullptr;
+        if (child) {
+            cout << prefix << indent() << (last ? "└── " : "├── ") << label << ": ";
+            for (NodeKind kind : inlineKinds) {
+                if (child->kind == kind) {
+                    inlineLeaf(child, quoteInline);
+                    below = false;
+                    break;
+                }
             }
-            cout << ")";
-        } else {
-            cout << "null";
+            cout << endl;
         }
-        cout << ")";
+        open(true, last ? "    " : "│   ");
+        return below;
     }
-    else if (node->nodeType == "TypeDecl") {
-        TypeDeclNode* td = static_cast<TypeDeclNode*>(node);
-        cout << "(name: '" << td->name << "', type: ";
-        if (td->arrayType) {
-            cout << "ArrayType)";
+
+    // An array bound: a plain number on the label's line, anything else below
+    void bound(const char* label, ASTNode* child, bool last) {
+        cout << prefix << indent() << (last ? "└── " : "├── ") << label << ": ";
+        if (child->kind == NK_NUMBER) {
+            cout << static_cast<NumberNode*>(child)->value << endl;
         } else {
-            cout << "'" << td->definition << "')";
+            cout << endl;
+            nest(child, last, last ? "    " : "│   ");
         }
     }
-    else if (node->nodeType == "ProcedureDecl") {
-        ProcedureDeclNode* pd = static_cast<ProcedureDeclNode*>(node);
-        cout << "(name: '" << pd->name << "', params: [";
-        for (size_t i = 0; i < pd->params.size(); i++) {
-            ParamNode* param = pd->params[i];
-            if (i > 0) cout << ", ";
-            cout << "(";
-            for (size_t j = 0; j < param->names.size(); j++) {
-                if (j > 0) cout << ", ";
-                cout << param->names[j];
-            }
-            cout << " : " << param->typeName << ")";
-        }
-        cout << "])";
+
+    // The node's line without prefix, newline or children, e.g. "Var(x)"
+    void inlineLeaf(ASTNode* node, bool quote = true) {
+        inlined = true;
+        quoteStrings = quote;
+        walk(node);
+        inlined = false;
+        quoteStrings = true;
     }
-    else if (node->nodeType == "FunctionDecl") {
-        FunctionDeclNode* fd = static_cast<FunctionDeclNode*>(node);
-        cout << "(name: '" << fd->name << "', params: [";
-        for (size_t i = 0; i < fd->params.size(); i++) {
-            ParamNode* param = fd->params[i];
+
+    static void params(Span<ParamNode*> params) {
+        for (size_t i = 0; i < params.size(); i++) {
+            ParamNode* param = params[i];
             if (i > 0) cout << ", ";
             cout << "(";
             for (size_t j = 0; j < param->names.size(); j++) {
@@ -981,304 +1071,80 @@ void printAST(ASTNode* node, const string& prefix, bool isLast) {
             }
             cout << " : " << param->typeName << ")";
         }
-        cout << "], returnType: '" << fd->returnType << "')";
-    }
-    else if (node->nodeType == "ProcedureCall") {
-        cout << "(name: " << static_cast<ProcedureCallNode*>(node)->procName << ")";
-    }
-    else if (node->nodeType == "For") {
     }
-    else if (node->nodeType == "ArrayType") {
-        ArrayTypeNode* atn = static_cast<ArrayTypeNode*>(node);
-        cout << "(elementType: '" << atn->elementType << "')";
-    }
-    
-    cout << endl;
-    
-    string newPrefix = prefix + (isLast ? "    " : "│   ");
-    
-    if (node->nodeType == "Program") {
-        ProgramNode* prog = static_cast<ProgramNode*>(node);
-        size_t totalChildren = (prog->declarations ? 1 : 0) + (prog->block ? 1 : 0);
-        size_t count = 0;
-        
-        if (prog->declarations) {
-            count++;
-            printAST(prog->declarations, newPrefix, count == totalChildren);
-        }
-        if (prog->block) {
-            printAST(prog->block, newPrefix, true);
-        }
-    }
-    else if (node->nodeType == "Declarations") {
-        DeclarationsNode* decls = static_cast<DeclarationsNode*>(node);
-        for (size_t i = 0; i < decls->declarations.size(); i++) {
-            printAST(decls->declarations[i], newPrefix, i + 1 == decls->declarations.size());
-        }
-    }
-    else if (node->nodeType == "Block") {
-        BlockNode* block = static_cast<BlockNode*>(node);
-        size_t totalChildren = block->declarations.size() + block->statements.size();
-        size_t count = 0;
-        
-        for (size_t i = 0; i < block->declarations.size(); i++) {
-            count++;
-            printAST(block->declarations[i], newPrefix, count == totalChildren);
-        }
-        for (size_t i = 0; i < block->statements.size(); i++) {
-            count++;
-            printAST(block->statements[i], newPrefix, count == totalChildren);
-        }
-    }
-    else if (node->nodeType == "VarDecl") {
-        VarDeclNode* vd = static_cast<VarDeclNode*>(node);
-        if (vd->arrayType) {
-            printAST(vd->arrayType, newPrefix, true);
-        }
-    }
-    else if (node->nodeType == "TypeDecl") {
-        TypeDeclNode* td = static_cast<TypeDeclNode*>(node);
-        if (td->arrayType) {
-            printAST(td->arrayType, newPrefix, true);
-        }
-    }
-    else if (node->nodeType == "ProcedureDecl") {
-        ProcedureDeclNode* pd = static_cast<ProcedureDeclNode*>(node);
-        if (pd->body) {
-            printAST(pd->body, newPrefix, true);
-        }
-    }
-    else if (node->nodeType == "FunctionDecl") {
-        FunctionDeclNode* fd = static_cast<FunctionDeclNode*>(node);
-        if (fd->body) {
-            printAST(fd->body, newPrefix, true);
-        }
-    }
-    else if (node->nodeType == "Assign") {
-        AssignNode* an = static_cast<AssignNode*>(node);
-        if (an->target) {
-            cout << newPrefix << (!an->value ? "└── " : "├── ") << "target: ";
-            if (an->target->nodeType == "Var") {
-                cout << "Var(" << static_cast<VarNode*>(an->target)->name << ")" << endl;
-            } else if (an->target->nodeType == "ArrayAccess") {
-                cout << "ArrayAccess: " << static_cast<ArrayAccessNode*>(an->target)->arrayName << endl;
-                if (static_cast<ArrayAccessNode*>(an->target)->index) {
-                    printAST(static_cast<ArrayAccessNode*>(an->target)->index, newPrefix + (!an->value ? "    " : "│   "), true);
-                }
-            } else {
-                cout << endl;
-                printAST(an->target, newPrefix + (!an->value ? "    " : "│   "), true);
-            }
-        }
-        if (an->value) {
-            cout << newPrefix << "└── value: ";
-            if (an->value->nodeType == "Number") {
-                cout << "Number(" << static_cast<NumberNode*>(an->value)->value << ")" << endl;
-            } else if (an->value->nodeType == "Real") {
-                cout << "Real(" << static_cast<RealNode*>(an->value)->value << ")" << endl;
-            } else if (an->value->nodeType == "String") {
-                cout << "String(\"" << static_cast<StringNode*>(an->value)->value << "\")" << endl;
-            } else if (an->value->nodeType == "Char") {
-                cout << "Char('" << static_cast<CharNode*>(an->value)->value << "')" << endl;
-            } else if (an->value->nodeType == "Boolean") {
-                cout << "Boolean(" << (static_cast<BoolNode*>(an->value)->value ? "true" : "false") << ")" << endl;
-            } else if (an->value->nodeType == "Var") {
-                cout << "Var(" << static_cast<VarNode*>(an->value)->name << ")" << endl;
-            } else {
-                cout << endl;
-                printAST(an->value, newPrefix + "    ", true);
-            }
-        }
-    }
-    else if (node->nodeType == "BinOp") {
-        BinOpNode* bn = static_cast<BinOpNode*>(node);
-        if (bn->left) {
-            cout << newPrefix << (!bn->right ? "└── " : "├── ") << "left: ";
-            if (bn->left->nodeType == "Number") {
-                cout << "Number(" << static_cast<NumberNode*>(bn->left)->value << ")" << endl;
-            } else if (bn->left->nodeType == "Var") {
-                cout << "Var(" << static_cast<VarNode*>(bn->left)->name << ")" << endl;
-            } else {
-                cout << endl;
-                printAST(bn->left, newPrefix + (!bn->right ? "    " : "│   "), true);
-            }
-        }
-        if (bn->right) {
-            cout << newPrefix << "└── right: ";
-            if (bn->right->nodeType == "Number") {
-                cout << "Number(" << static_cast<NumberNode*>(bn->right)->value << ")" << endl;
-            } else if (bn->right->nodeType == "Var") {
-                cout << "Var(" << static_cast<VarNode*>(bn->right)->name << ")" << endl;
-            } else {
-                cout << endl;
-                printAST(bn->right, newPrefix + "    ", true);
-            }
-        }
-    }
-    else if (node->nodeType == "UnaryOp") {
-        UnaryOpNode* un = static_cast<UnaryOpNode*>(node);
-        if (un->operand) {
-            cout << newPrefix << "└── operand: ";
-            if (un->operand->nodeType == "Number") {
-                cout << "Number(" << static_cast<NumberNode*>(un->operand)->value << ")" << endl;
-            } else if (un->operand->nodeType == "Var") {
-                cout << "Var(" << static_cast<VarNode*>(un->operand)->name << ")" << endl;
-            } else {
-                cout << endl;
-                printAST(un->operand, newPrefix + "    ", true);
-            }
-        }
-    }
-    else if (node->nodeType == "ArrayAccess") {
-        ArrayAccessNode* aan = static_cast<ArrayAccessNode*>(node);
-        if (aan->index) {
-            cout << newPrefix << "└── index: ";
-            if (aan->index->nodeType == "Number") {
-                cout << "Number(" << static_cast<NumberNode*>(aan->index)->value << ")" << endl;
-            } else if (aan->index->nodeType == "Var") {
-                cout << "Var(" << static_cast<VarNode*>(aan->index)->name << ")" << endl;
-            } else {
-                cout << endl;
-                printAST(aan->index, newPrefix + "    ", true);
-            }
-        }
-    }
-    else if (node->nodeType == "If") {
-        IfNode* ifn = static_cast<IfNode*>(node);
-        size_t childCount = (ifn->condition ? 1 : 0) + (ifn->thenBranch ? 1 : 0) + (ifn->elseBranch ? 1 : 0);
-        size_t count = 0;
-        
-        if (ifn->condition) {
-            count++;
-            cout << newPrefix << (count == childCount ? "└── " : "├── ") << "condition: " << endl;
-            printAST(ifn->condition, newPrefix + (count == childCount ? "    " : "│   "), true);
-        }
-        if (ifn->thenBranch) {
-            count++;
-            cout << newPrefix << (count == childCount ? "└── " : "├── ") << "thenBranch: " << endl;
-            printAST(ifn->thenBranch, newPrefix + (count == childCount ? "    " : "│   "), true);
-        }
-        if (ifn->elseBranch) {
-            count++;
-            cout << newPrefix << (count == childCount ? "└── " : "├── ") << "elseBranch: " << endl;
-            printAST(ifn->elseBranch, newPrefix + (count == childCount ? "    " : "│   "), true);
-        }
+
+    // What follows the kind name on a node's line
+    static void describe(ASTNode*) {}
+    static void describe(NumberNode* node) { cout << "(" << node->value << ")"; }
+    static void describe(RealNode* node) { cout << "(" << node->value << ")"; }
+    void describe(StringNode* node) {
+        if (quoteStrings) cout << "(\"" << node->value << "\")";
+        else cout << "(" << node->value << ")";
+    }
+    static void describe(CharNode* node) { cout << "('" << node->value << "')"; }
+    static void describe(BoolNode* node) { cout << "(" << (node->value ? "true" : "false") << ")"; }
+    static void describe(VarNode* node) { cout << "(" << node->name << ")"; }
+    static void describe(ArrayAccessNode* node) { cout << ": " << node->arrayName; }
+    static void describe(BinOpNode* node) { cout << "(" << node->op << ")"; }
+    static void describe(UnaryOpNode* node) { cout << "(" << node->op << ")"; }
+    static void describe(ProgramNode* node) { cout << "(name: " << node->name << ")"; }
+    static void describe(ProcedureCallNode* node) { cout << "(name: " << node->procName << ")"; }
+    static void describe(ArrayTypeNode* node) { cout << "(elementType: '" << node->elementType << "')"; }
+
+    static void describe(VarDeclNode* node) {
+        cout << "(name: '" << node->names[0] << "', type: ";
+        if (node->arrayType) cout << "ArrayType)";
+        else cout << "'" << node->typeName << "')";
     }
-    else if (node->nodeType == "While") {
-        WhileNode* wn = static_cast<WhileNode*>(node);
-        if (wn->condition) {
-            cout << newPrefix << (!wn->body ? "└── " : "├── ") << "condition: " << endl;
-            printAST(wn->condition, newPrefix + (!wn->body ? "    " : "│   "), true);
-        }
-        if (wn->body) {
-            cout << newPrefix << "└── body: " << endl;
-            printAST(wn->body, newPrefix + "    ", true);
-        }
+
+    static void describe(TypeDeclNode* node) {
+        cout << "(name: '" << node->name << "', type: ";
+        if (node->arrayType) cout << "ArrayType)";
+        else cout << "'" << node->definition << "')";
     }
-    else if (node->nodeType == "For") {
-        ForNode* fn = static_cast<ForNode*>(node);
-        size_t childCount = 5;  // counter, start, end, body, ascending
-        size_t count = 0;
-        
-        // counter
-        if (fn->counter) {
-            count++;
-            cout << newPrefix << (count == childCount ? "└── " : "├── ") << "counter: ";
-            if (fn->counter->nodeType == "Var") {
-                cout << "Var(" << static_cast<VarNode*>(fn->counter)->name << ")" << endl;
-            } else {
-                cout << endl;
-                printAST(fn->counter, newPrefix + (count == childCount ? "    " : "│   "), true);
-            }
-        }
-        
-        // start
-        if (fn->start) {
-            count++;
-            cout << newPrefix << (count == childCount ? "└── " : "├── ") << "start: " << endl;
-            printAST(fn->start, newPrefix + (count == childCount ? "    " : "│   "), true);
-        }
-        
-        // end
-        if (fn->end) {
-            count++;
-            cout << newPrefix << (count == childCount ? "└── " : "├── ") << "end: " << endl;
-            printAST(fn->end, newPrefix + (count == childCount ? "    " : "│   "), true);
-        }
-        
-        // body
-        if (fn->body) {
-            count++;
-            cout << newPrefix << (count == childCount ? "└── " : "├── ") << "body: " << endl;
-            printAST(fn->body, newPrefix + (count == childCount ? "    " : "│   "), true);
-        }
-        
-        // ascending
-        count++;
-        cout << newPrefix << "└── ascending: " << (fn->ascending ? "true" : "false") << endl;
+
+    void describe(ConstDeclNode* node) {
+        cout << " (name: " << node->name << ", value: ";
+        if (!node->value) cout << "null";
+        else if (node->value->kind <= NK_BOOLEAN) inlineLeaf(node->value);     // a literal
+        else cout << nodeKindName(node->value->kind) << "()";
+        cout << ")";
     }
-    else if (node->nodeType == "ProcedureCall") {
-        ProcedureCallNode* pc = static_cast<ProcedureCallNode*>(node);
-        for (size_t i = 0; i < pc->args.size(); i++) {
-            bool isLast = (i + 1 == pc->args.size());
-            cout << newPrefix << (isLast ? "└── " : "├── ") << "arg: ";
-            
-            if (pc->args[i]->nodeType == "Number") {
-                cout << "Number(" << static_cast<NumberNode*>(pc->args[i])->value << ")" << endl;
-            } else if (pc->args[i]->nodeType == "Var") {
-                cout << "Var(" << static_cast<VarNode*>(pc->args[i])->name << ")" << endl;
-            } else if (pc->args[i]->nodeType == "String") {
-                cout << "String(" << static_cast<StringNode*>(pc->args[i])->value << ")" << endl;
-            } else if (pc->args[i]->nodeType == "Boolean") {
-                cout << "Boolean(" << (static_cast<BoolNode*>(pc->args[i])->value ? "true" : "false") << ")" << endl;
-            } else {
-                cout << endl;
-                printAST(pc->args[i], newPrefix + (isLast ? "    " : "│   "), true);
-            }
-        }
+
+    static void describe(ProcedureDeclNode* node) {
+        cout << "(name: '" << node->name << "', params: [";
+        params(node->params);
+        cout << "])";
     }
-    else if (node->nodeType == "ArrayType") {
-        ArrayTypeNode* atn = static_cast<ArrayTypeNode*>(node);
-        size_t childCount = (atn->rangeStart ? 1 : 0) + (atn->rangeEnd ? 1 : 0);
-        size_t count = 0;
-        
-        if (atn->rangeStart) {
-            count++;
-            cout << newPrefix << (count == childCount ? "└── " : "├── ");
-            cout << "startRange: ";
-            if (atn->rangeStart->nodeType == "Number") {
-                cout << static_cast<NumberNode*>(atn->rangeStart)->value << endl;
-            } else {
-                cout << endl;
-                printAST(atn->rangeStart, newPrefix + (count == childCount ? "    " : "│   "), count == childCount);
-            }
-        }
-        if (atn->rangeEnd) {
-            count++;
-            cout << newPrefix << (count == childCount ? "└── " : "├── ");
-            cout << "endRange: ";
-            if (atn->rangeEnd->nodeType == "Number") {
-                cout << static_cast<NumberNode*>(atn->rangeEnd)->value << endl;
-            } else {
-                cout << endl;
-                printAST(atn->rangeEnd, newPrefix + (count == childCount ? "    " : "│   "), count == childCount);
-            }
-        }
+
+    static void describe(FunctionDeclNode* node) {
+        cout << "(name: '" << node->name << "', params: [";
+        params(node->params);
+        cout << "], returnType: '" << node->returnType << "')";
     }
+
+    bool inlined = false;                   // inlineLeaf in progress
+    bool quoteStrings = true;
+};
+
+void printAST(ASTNode* node, const string& prefix, bool isLast) {
+    ASTPrinter(prefix, isLast).walk(node);
 }
 
 // ENTRY POINT
-ASTNode* buildAST(ParseNode* root) {
+ASTNode* buildAST(ParseNode* root, Arena &arena) {
     if (!root) {
         cerr << "Error: Parse tree root is null\n";
         return nullptr;
     }
-    return convert(root);
+    return ASTBuilder{arena}.convert(root);
 }
 
-ASTNode* ASTMain(ParseNode* root) {
-    ASTNode* ast = buildAST(root);
-    
+ASTNode* ASTMain(ParseNode* root, Arena &arena) {
+    return showAST(buildAST(root, arena));
+}
+
+ASTNode* showAST(ASTNode* ast) {
     if (!ast) {
         cerr << "Error: Failed to build AST\n";
         return nullptr;
@@ -0,0 +1,378 @@
+#include "flat_ast.hpp"
+#include <iostream>
+
+using namespace std;
+
+// ========== BUILD ==========
+
+static uint32_t addNames(FlatAST& out, Span<Symbol> names) {
+    uint32_t at = (uint32_t)out.lists.size();
+    out.lists.push_back((uint32_t)names.size());
+    for (Symbol s : names) out.lists.push_back(s.id);
+    return at;
+}
+
+// Record for n without its children; returns its index
+static uint32_t emit(FlatAST& out, ASTNode* n) {
+    uint32_t at = out.size();
+    FlatNode f{FK_EMPTY, 0, 0, at + 1, 0, 0};
+    FlatDecoration d;
+    if (!n) {
+        out.nodes.push_back(f);
+        out.decorations.push_back(d);
+        return at;
+    }
+
+    f.kind = n->kind;
+    d.dataType = n->dataType;
+    d.symbolIndex = n->symbolIndex;
+    d.scopeLevel = n->scopeLevel;
+
+    switch (n->kind) {
+    case NK_NUMBER: f.a = (uint32_t)static_cast<NumberNode*>(n)->value; break;
+    case NK_REAL:
+        f.a = (uint32_t)out.reals.size();
+        out.reals.push_back(static_cast<RealNode*>(n)->value);
+        break;
+    case NK_STRING:
+        f.a = (uint32_t)out.strings.size();
+        out.strings.push_back(static_cast<StringNode*>(n)->value);
+        break;
+    case NK_CHAR: f.a = (unsigned char)static_cast<CharNode*>(n)->value; break;
+    case NK_BOOLEAN: f.a = static_cast<BoolNode*>(n)->value; break;
+    case NK_VAR: f.a = static_cast<VarNode*>(n)->name.id; break;
+    case NK_ARRAY_ACCESS: f.a = static_cast<ArrayAccessNode*>(n)->arrayName.id; break;
+    case NK_BIN_OP: f.a = static_cast<BinOpNode*>(n)->op.id; break;
+    case NK_UNARY_OP: f.a = static_cast<UnaryOpNode*>(n)->op.id; break;
+    case NK_PROCEDURE_CALL: f.a = static_cast<ProcedureCallNode*>(n)->procName.id; break;
+    case NK_FOR:
+        if (static_cast<ForNode*>(n)->ascending) f.flags |= FF_ASCENDING;
+        break;
+    case NK_ARRAY_TYPE: f.a = static_cast<ArrayTypeNode*>(n)->elementType.id; break;
+    case NK_VAR_DECL: {
+        VarDeclNode* v = static_cast<VarDeclNode*>(n);
+        f.a = addNames(out, v->names);
+        f.b = v->typeName.id;
+        break;
+    }
+    case NK_CONST_DECL: f.a = static_cast<ConstDeclNode*>(n)->name.id; break;
+    case NK_TYPE_DECL: {
+        TypeDeclNode* t = static_cast<TypeDeclNode*>(n);
+        f.a = t->name.id;
+        f.b = t->definition.id;
+        break;
+    }
+    case NK_PARAM: {
+        ParamNode* p = static_cast<ParamNode*>(n);
+        f.a = addNames(out, p->names);
+        f.b = p->typeName.id;
+        if (p->isVar) f.flags |= FF_VAR_PARAM;
+        break;
+    }
+    case NK_PROCEDURE_DECL: f.a = static_cast<ProcedureDeclNode*>(n)->name.id; break;
+    case NK_FUNCTION_DECL: {
+        FunctionDeclNode* fd = static_cast<FunctionDeclNode*>(n);
+        f.a = fd->name.id;
+        f.b = fd->returnType.id;
+        break;
+    }
+    case NK_BLOCK: f.a = (uint32_t)static_cast<BlockNode*>(n)->declarations.size(); break;
+    case NK_PROGRAM: f.a = static_cast<ProgramNode*>(n)->name.id; break;
+    default: break;
+    }
+
+    out.nodes.push_back(f);
+    out.decorations.push_back(d);
+    return at;
+}
+
+// Child slots of n in order; null marks an absent fixed slot
+static void childSlots(ASTNode* n, vector<ASTNode*>& kids) {
+    kids.clear();
+    auto optional = [&](ASTNode* c) { if (c) kids.push_back(c); };
+    switch (n->kind) {
+    case NK_ARRAY_ACCESS: optional(static_cast<ArrayAccessNode*>(n)->index); break;
+    case NK_BIN_OP: {
+        BinOpNode* b = static_cast<BinOpNode*>(n);
+        kids = {b->left, b->right};
+        break;
+    }
+    case NK_UNARY_OP: optional(static_cast<UnaryOpNode*>(n)->operand); break;
+    case NK_ASSIGN: {
+        AssignNode* a = static_cast<AssignNode*>(n);
+        kids = {a->target, a->value};
+        break;
+    }
+    case NK_PROCEDURE_CALL:
+        for (auto arg : static_cast<ProcedureCallNode*>(n)->args) kids.push_back(arg);
+        break;
+    case NK_IF: {
+        IfNode* i = static_cast<IfNode*>(n);
+        kids = {i->condition, i->thenBranch, i->elseBranch};
+        break;
+    }
+    case NK_WHILE: {
+        WhileNode* w = static_cast<WhileNode*>(n);
+        kids = {w->condition, w->body};
+        break;
+    }
+    case NK_FOR: {
+        ForNode* f = static_cast<ForNode*>(n);
+        kids = {f->counter, f->start, f->end, f->body};
+        break;
+    }
+    case NK_ARRAY_TYPE: {
+        ArrayTypeNode* a = static_cast<ArrayTypeNode*>(n);
+        kids = {a->rangeStart, a->rangeEnd};
+        break;
+    }
+    case NK_VAR_DECL: optional(static_cast<VarDeclNode*>(n)->arrayType); break;
+    case NK_CONST_DECL: optional(static_cast<ConstDeclNode*>(n)->value); break;
+    case NK_TYPE_DECL: optional(static_cast<TypeDeclNode*>(n)->arrayType); break;
+    case NK_PROCEDURE_DECL: {
+        ProcedureDeclNode* p = static_cast<ProcedureDeclNode*>(n);
+        for (auto param : p->params) kids.push_back(param);
+        kids.push_back(p->body);
+        break;
+    }
+    case NK_FUNCTION_DECL: {
+        FunctionDeclNode* f = static_cast<FunctionDeclNode*>(n);
+        for (auto param : f->params) kids.push_back(param);
+        kids.push_back(f->body);
+        break;
+    }
+    case NK_BLOCK: {
+        BlockNode* b = static_cast<BlockNode*>(n);
+        for (auto d : b->declarations) kids.push_back(d);
+        for (auto s : b->statements) kids.push_back(s);
+        break;
+    }
+    case NK_DECLARATIONS:
+        for (auto d : static_cast<DeclarationsNode*>(n)->declarations) kids.push_back(d);
+        break;
+    case NK_PROGRAM: {
+        ProgramNode* p = static_cast<ProgramNode*>(n);
+        kids = {p->declarations, p->block};
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+FlatAST flattenAST(ASTNode* root) {
+    FlatAST out;
+    if (!root) return out;
+
+    // Preorder with an explicit stack; a closing entry fixes up the end of
+    // the node it names once its whole subtree has been emitted
+    struct Item {
+        ASTNode* node;
+        uint32_t close;
+    };
+    const uint32_t OPEN = UINT32_MAX;
+    vector<Item> work{{root, OPEN}};
+    vector<ASTNode*> kids;
+    while (!work.empty()) {
+        Item item = work.back();
+        work.pop_back();
+        if (item.close != OPEN) {
+            out.nodes[item.close].end = out.size();
+            continue;
+        }
+        uint32_t at = emit(out, item.node);
+        if (!item.node) continue;
+        childSlots(item.node, kids);
+        if (kids.empty()) continue;
+        work.push_back({nullptr, at});
+        for (size_t i = kids.size(); i-- > 0; ) work.push_back({kids[i], OPEN});
+    }
+    return out;
+}
+
+// ========== EXPAND ==========
+
+static Span<Symbol> expandNames(const FlatAST& ast, uint32_t list, Arena &arena) {
+    vector<Symbol> names;
+    for (uint32_t id : ast.nameList(list)) names.push_back(Symbol(id));
+    return arena.copySpan(names);
+}
+
+// Node i alone; its children are built already and passed in slot order
+static ASTNode* expandNode(const FlatAST& ast, uint32_t i, const vector<ASTNode*>& kids, Arena &arena) {
+    const FlatNode& f = ast.nodes[i];
+    auto kid = [&](size_t k) { return k < kids.size() ? kids[k] : nullptr; };
+    auto kidSpan = [&](size_t from, size_t to) {
+        vector<ASTNode*> items(kids.begin() + from, kids.begin() + to);
+        return arena.copySpan(items);
+    };
+    auto block = [&](ASTNode* n) {
+        return n && n->kind == NK_BLOCK ? static_cast<BlockNode*>(n) : nullptr;
+    };
+    auto params = [&]() {                   // all but the last child, the body
+        vector<ParamNode*> items;
+        for (size_t k = 0; k + 1 < kids.size(); k++) {
+            if (kids[k] && kids[k]->kind == NK_PARAM) items.push_back(static_cast<ParamNode*>(kids[k]));
+        }
+        return arena.copySpan(items);
+    };
+
+    switch (f.kind) {
+    case NK_NUMBER: return arena.make<NumberNode>((int)f.a);
+    case NK_REAL: return arena.make<RealNode>(ast.reals[f.a]);
+    case NK_STRING: return arena.make<StringNode>(ast.strings[f.a]);
+    case NK_CHAR: return arena.make<CharNode>((char)f.a);
+    case NK_BOOLEAN: return arena.make<BoolNode>(f.a != 0);
+    case NK_VAR: return arena.make<VarNode>(Symbol(f.a));
+    case NK_ARRAY_ACCESS: return arena.make<ArrayAccessNode>(Symbol(f.a), kid(0));
+    case NK_BIN_OP: return arena.make<BinOpNode>(Symbol(f.a), kid(0), kid(1));
+    case NK_UNARY_OP: return arena.make<UnaryOpNode>(Symbol(f.a), kid(0));
+    case NK_ASSIGN: return arena.make<AssignNode>(kid(0), kid(1));
+    case NK_PROCEDURE_CALL: {
+        auto *call = arena.make<ProcedureCallNode>(Symbol(f.a));
+        call->args = kidSpan(0, kids.size());
+        return call;
+    }
+    case NK_IF: return arena.make<IfNode>(kid(0), kid(1), kid(2));
+    case NK_WHILE: return arena.make<WhileNode>(kid(0), kid(1));
+    case NK_FOR: return arena.make<ForNode>(kid(0), kid(1), kid(2), kid(3), (f.flags & FF_ASCENDING) != 0);
+    case NK_ARRAY_TYPE: return arena.make<ArrayTypeNode>(kid(0), kid(1), Symbol(f.a));
+    case NK_VAR_DECL: {
+        auto *v = arena.make<VarDeclNode>();
+        v->names = expandNames(ast, f.a, arena);
+        v->typeName = Symbol(f.b);
+        if (kid(0) && kid(0)->kind == NK_ARRAY_TYPE) v->arrayType = static_cast<ArrayTypeNode*>(kid(0));
+        return v;
+    }
+    case NK_CONST_DECL: return arena.make<ConstDeclNode>(Symbol(f.a), kid(0));
+    case NK_TYPE_DECL: {
+        auto *t = arena.make<TypeDeclNode>(Symbol(f.a), Symbol(f.b));
+        if (kid(0) && kid(0)->kind == NK_ARRAY_TYPE) t->arrayType = static_cast<ArrayTypeNode*>(kid(0));
+        return t;
+    }
+    case NK_PARAM: {
+        auto *p = arena.make<ParamNode>();
+        p->names = expandNames(ast, f.a, arena);
+        p->typeName = Symbol(f.b);
+        p->isVar = (f.flags & FF_VAR_PARAM) != 0;
+        return p;
+    }
+    case NK_PROCEDURE_DECL: {
+        auto *proc = arena.make<ProcedureDeclNode>(Symbol(f.a));
+        proc->params = params();
+        if (!kids.empty()) proc->body = block(kids.back());
+        return proc;
+    }
+    case NK_FUNCTION_DECL: {
+        auto *func = arena.make<FunctionDeclNode>(Symbol(f.a), Symbol(f.b));
+        func->params = params();
+        if (!kids.empty()) func->body = block(kids.back());
+        return func;
+    }
+    case NK_BLOCK: {
+        auto *b = arena.make<BlockNode>();
+        size_t split = min((size_t)f.a, kids.size());
+        b->declarations = kidSpan(0, split);
+        b->statements = kidSpan(split, kids.size());
+        return b;
+    }
+    case NK_DECLARATIONS: {
+        auto *d = arena.make<DeclarationsNode>();
+        d->declarations = kidSpan(0, kids.size());
+        return d;
+    }
+    case NK_PROGRAM: {
+        auto *prog = arena.make<ProgramNode>(Symbol(f.a));
+        if (kid(0) && kid(0)->kind == NK_DECLARATIONS) prog->declarations = static_cast<DeclarationsNode*>(kid(0));
+        prog->block = block(kid(1));
+        return prog;
+    }
+    default:
+        return nullptr;                     // FK_EMPTY
+    }
+}
+
+ASTNode* expandAST(const FlatAST& ast, Arena &arena) {
+    if (ast.empty()) return nullptr;
+
+    // Children sit after their parent, so walking backwards finds them built
+    vector<ASTNode*> built(ast.size(), nullptr);
+    vector<ASTNode*> kids;
+    for (uint32_t i = ast.size(); i-- > 0; ) {
+        kids.clear();
+        for (uint32_t c : ast.children(i)) kids.push_back(built[c]);
+        ASTNode* n = expandNode(ast, i, kids, arena);
+        if (n) {
+            const FlatDecoration& d = ast.decorations[i];
+            n->dataType = d.dataType;
+            n->symbolIndex = d.symbolIndex;
+            n->scopeLevel = d.scopeLevel;
+        }
+        built[i] = n;
+    }
+    return built[0];
+}
+
+// ========== PRINT ==========
+
+static void printNames(const FlatAST& ast, uint32_t list) {
+    Span<const uint32_t> names = ast.nameList(list);
+    for (size_t i = 0; i < names.size(); i++) {
+        if (i > 0) cout << ", ";
+        cout << Symbol(names[i]);
+    }
+}
+
+void printFlatAST(const FlatAST& ast) {
+    vector<uint32_t> open;                  // ends of the enclosing nodes
+    for (uint32_t i = 0; i < ast.size(); i++) {
+        const FlatNode& f = ast.nodes[i];
+        while (!open.empty() && open.back() <= i) open.pop_back();
+
+        cout << i << "\t" << string(open.size() * 2, ' ');
+        if (f.kind == FK_EMPTY) {
+            cout << "-" << endl;
+            continue;
+        }
+        cout << nodeKindName((NodeKind)f.kind);
+
+        switch (f.kind) {
+        case NK_NUMBER: cout << "(" << (int)f.a << ")"; break;
+        case NK_REAL: cout << "(" << ast.reals[f.a] << ")"; break;
+        case NK_STRING: cout << "(\"" << ast.strings[f.a] << "\")"; break;
+        case NK_CHAR: cout << "('" << (char)f.a << "')"; break;
+        case NK_BOOLEAN: cout << "(" << (f.a ? "true" : "false") << ")"; break;
+        case NK_VAR:
+        case NK_ARRAY_ACCESS:
+        case NK_BIN_OP:
+        case NK_UNARY_OP:
+        case NK_PROCEDURE_CALL:
+        case NK_CONST_DECL:
+        case NK_PROCEDURE_DECL:
+        case NK_PROGRAM:
+            cout << "(" << Symbol(f.a) << ")";
+            break;
+        case NK_FOR: cout << "(" << (f.flags & FF_ASCENDING ? "ke" : "turun-ke") << ")"; break;
+        case NK_ARRAY_TYPE: cout << "(elementType: '" << Symbol(f.a) << "')"; break;
+        case NK_VAR_DECL:
+        case NK_PARAM:
+            cout << "(";
+            if (f.flags & FF_VAR_PARAM) cout << "var ";
+            printNames(ast, f.a);
+            cout << " : '" << Symbol(f.b) << "')";
+            break;
+        case NK_TYPE_DECL: cout << "(" << Symbol(f.a) << " = '" << Symbol(f.b) << "')"; break;
+        case NK_FUNCTION_DECL: cout << "(" << Symbol(f.a) << " : '" << Symbol(f.b) << "')"; break;
+        case NK_BLOCK: cout << "(declarations: " << f.a << ")"; break;
+        default: break;
+        }
+
+        const FlatDecoration& d = ast.decorations[i];
+        if (!d.dataType.empty()) cout << " type:'" << d.dataType << "'";
+        if (d.symbolIndex >= 0) cout << " tab:" << d.symbolIndex;
+        if (d.scopeLevel >= 0) cout << " lev:" << d.scopeLevel;
+        cout << endl;
+
+        open.push_back(f.end);
+    }
+}
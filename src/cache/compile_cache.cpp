@@ -0,0 +1,446 @@
+#include "compile_cache.hpp"
+#include "flat_ast.hpp"
+#include "tab.hpp"
+#include "btab.hpp"
+#include "atab.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+#include <unordered_map>
+
+using namespace std;
+
+// ========== FORMAT ==========
+
+enum CacheSection {
+    SEC_NODES,          // FlatNode, symbols as name indices
+    SEC_DECORATIONS,    // FlatDecoration, dataType as a name index
+    SEC_REALS,          // double
+    SEC_LISTS,          // uint32_t, name lists of name indices
+    SEC_STRINGS,        // TextRef, string literals
+    SEC_NAMES,          // TextRef by name index; 0 is the empty name
+    SEC_TAB,            // CachedTabEntry
+    SEC_BTAB,           // BtabEntry
+    SEC_ATAB,           // AtabEntry
+    SEC_DIAGNOSTICS,    // CachedDiagnostic, in the order written
+    SEC_TEXT,           // char, everything TextRefs point at
+    SEC_COUNT
+};
+
+struct SectionRef {
+    uint64_t offset;    // from the start of the file, 8-byte aligned
+    uint64_t count;     // records
+};
+
+struct TextRef {
+    uint32_t offset;    // into SEC_TEXT
+    uint32_t length;
+};
+
+struct CachedDiagnostic {
+    uint64_t at;        // cout bytes written before it
+    TextRef text;
+};
+
+struct CachedTabEntry {
+    uint32_t name;      // name index
+    int32_t link, obj, type, ref, nrm, lev, adr;
+    uint32_t initialized;
+};
+
+static const char CACHE_MAGIC[4] = {'P', 'A', 'S', 'C'};
+static const uint32_t CACHE_BYTE_ORDER = 0x01020304;      // files do not move between byte orders
+
+struct CacheHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint32_t completed;
+    uint64_t key;
+    uint64_t checksum;  // of everything after the header
+    SectionRef sections[SEC_COUNT];
+};
+
+static const size_t RECORD_SIZE[SEC_COUNT] = {
+    sizeof(FlatNode), sizeof(FlatDecoration), sizeof(double), sizeof(uint32_t),
+    sizeof(TextRef), sizeof(TextRef), sizeof(CachedTabEntry), sizeof(BtabEntry),
+    sizeof(AtabEntry), sizeof(CachedDiagnostic), sizeof(char)
+};
+
+static_assert(is_trivially_copyable<FlatNode>::value && is_trivially_copyable<FlatDecoration>::value &&
+              is_trivially_copyable<BtabEntry>::value && is_trivially_copyable<AtabEntry>::value,
+              "cache records are copied bytewise");
+
+// FNV-1a, 64-bit
+class Hasher {
+public:
+    void bytes(const void *data, size_t n) {
+        const unsigned char *p = static_cast<const unsigned char *>(data);
+        for (size_t i = 0; i < n; i++) h = (h ^ p[i]) * 1099511628211ull;
+    }
+    template <class T>
+    void value(const T &v) { bytes(&v, sizeof(v)); }
+    template <class T>
+    void array(const vector<T> &v) {
+        value((uint64_t)v.size());
+        bytes(v.data(), v.size() * sizeof(T));
+    }
+    void text(string_view s) {
+        value((uint64_t)s.size());
+        bytes(s.data(), s.size());
+    }
+    uint64_t result() const { return h; }
+
+private:
+    uint64_t h = 14695981039346656037ull;
+};
+
+// ========== KEY ==========
+
+uint64_t compileKey(string_view source, const LexerRules &rules, unsigned maxErrors, unsigned maxDepth) {
+    Hasher h;
+    h.value(CACHE_VERSION);
+    h.value((uint64_t)COMPILER_BUILD_ID);
+    h.text(source);
+
+    const DFATable &dfa = rules.dfa;
+    h.value(dfa.numStates);
+    h.value(dfa.startState);
+    h.value(dfa.identifierState);
+    h.value(dfa.errorState);
+    h.array(dfa.next);
+    h.array(dfa.isFinal);
+    h.array(dfa.tokenKind);
+    h.bytes(dfa.skipInStart, sizeof(dfa.skipInStart));
+
+    const KeywordTable &words = rules.words;
+    h.value(words.seed);
+    h.value(words.mask);
+    for (const string &w : words.words) h.text(w);
+    h.array(words.classes);
+    h.array(words.subs);
+
+    h.value(maxErrors);
+    h.value(maxDepth);
+    return h.result();
+}
+
+string cachePath(const string &dir, uint64_t key) {
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.pasc", (unsigned long long)key);
+    return dir + "/" + name;
+}
+
+// ========== SAVE ==========
+
+bool saveCompile(const string &path, uint64_t key, ASTNode* ast, bool completed,
+                 const vector<Diagnostic> &diagnostics) {
+    if (!ast) return false;
+
+    // Symbol ids only mean something inside this process; store names instead
+    FlatAST flat = flattenAST(ast);
+    string text;
+    auto addText = [&](string_view s) {
+        TextRef ref{(uint32_t)text.size(), (uint32_t)s.size()};
+        text.append(s.data(), s.size());
+        return ref;
+    };
+    vector<TextRef> names{TextRef{0, 0}};
+    unordered_map<uint32_t, uint32_t> local{{0, 0}};
+    auto nameIndex = [&](uint32_t id) {
+        auto it = local.find(id);
+        if (it != local.end()) return it->second;
+        uint32_t at = (uint32_t)names.size();
+        local.emplace(id, at);
+        names.push_back(addText(Symbol(id).str()));
+        return at;
+    };
+    flat.forEachSymbol([&](uint32_t &id) { id = nameIndex(id); });
+
+    vector<TextRef> strings;
+    for (string_view s : flat.strings) strings.push_back(addText(s));
+
+    vector<CachedTabEntry> tabs;
+    for (const TabEntry &e : tab) {
+        tabs.push_back(CachedTabEntry{nameIndex(e.name.id), e.link, e.obj, e.type, e.ref,
+                                      e.nrm, e.lev, e.adr, e.initialized});
+    }
+
+    vector<CachedDiagnostic> runs;
+    for (const Diagnostic &d : diagnostics) runs.push_back(CachedDiagnostic{d.at, addText(d.text)});
+
+    CacheHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.version = CACHE_VERSION;
+    header.byteOrder = CACHE_BYTE_ORDER;
+    header.completed = completed;
+    header.key = key;
+    if (text.size() > UINT32_MAX) return false;
+
+    string file(sizeof(CacheHeader), '\0');
+    auto put = [&](CacheSection sec, const void *data, size_t count) {
+        file.resize((file.size() + 7) & ~(size_t)7, '\0');
+        header.sections[sec] = SectionRef{file.size(), count};
+        file.append(static_cast<const char *>(data), count * RECORD_SIZE[sec]);
+    };
+    put(SEC_NODES, flat.nodes.data(), flat.nodes.size());
+    put(SEC_DECORATIONS, flat.decorations.data(), flat.decorations.size());
+    put(SEC_REALS, flat.reals.data(), flat.reals.size());
+    put(SEC_LISTS, flat.lists.data(), flat.lists.size());
+    put(SEC_STRINGS, strings.data(), strings.size());
+    put(SEC_NAMES, names.data(), names.size());
+    put(SEC_TAB, tabs.data(), tabs.size());
+    put(SEC_BTAB, btab.data(), btab.size());
+    put(SEC_ATAB, atab.data(), atab.size());
+    put(SEC_DIAGNOSTICS, runs.data(), runs.size());
+    put(SEC_TEXT, text.data(), text.size());
+
+    Hasher sum;
+    sum.bytes(file.data() + sizeof(CacheHeader), file.size() - sizeof(CacheHeader));
+    header.checksum = sum.result();
+    memcpy(&file[0], &header, sizeof(header));
+
+    // The directory is created on first use; one level only
+    size_t slash = path.rfind('/');
+    if (slash != string::npos && slash > 0) mkdir(path.substr(0, slash).c_str(), 0777);
+
+    string tmp = path + ".tmp" + to_string(getpid());
+    int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0) return false;
+    size_t done = 0;
+    while (done < file.size()) {
+        ssize_t n = ::write(fd, file.data() + done, file.size() - done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        done += (size_t)n;
+    }
+    bool ok = ::close(fd) == 0 && done == file.size();
+    if (ok) ok = rename(tmp.c_str(), path.c_str()) == 0;
+    if (!ok) unlink(tmp.c_str());
+    return ok;
+}
+
+// ========== LOAD ==========
+
+// A read-only mapping of a whole file
+class MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    ~MappedFile() {
+        if (data) munmap(const_cast<char *>(data), size);
+    }
+
+    bool open(const string &path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            void *p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) {
+                data = static_cast<const char *>(p);
+                size = (size_t)st.st_size;
+            }
+        }
+        ::close(fd);
+        return data != nullptr;
+    }
+
+    const char *data = nullptr;
+    size_t size = 0;
+};
+
+// Records of one section, read in place
+template <class T>
+static Span<const T> section(const MappedFile &file, const CacheHeader &header, CacheSection sec) {
+    const SectionRef &ref = header.sections[sec];
+    return Span<const T>{reinterpret_cast<const T *>(file.data + ref.offset), ref.count};
+}
+
+// Every section inside the file, aligned and after the header
+static bool sectionsFit(const CacheHeader &header, size_t fileSize) {
+    for (int sec = 0; sec < SEC_COUNT; sec++) {
+        const SectionRef &ref = header.sections[sec];
+        if (ref.offset < sizeof(CacheHeader) || ref.offset % 8 != 0 || ref.offset > fileSize) return false;
+        if (ref.count > (fileSize - ref.offset) / RECORD_SIZE[sec]) return false;
+    }
+    return true;
+}
+
+// Subtrees nest, and payload indices stay inside their tables
+static bool wellFormed(const FlatAST &flat, size_t nameCount) {
+    uint32_t n = flat.size();
+    if (n == 0 || flat.nodes[0].end != n || flat.decorations.size() != n) return false;
+    vector<uint32_t> open;
+    for (uint32_t i = 0; i < n; i++) {
+        const FlatNode &f = flat.nodes[i];
+        while (!open.empty() && open.back() <= i) open.pop_back();
+        if (f.kind > FK_EMPTY || f.end <= i || f.end > n) return false;
+        if (!open.empty() && f.end > open.back()) return false;
+        open.push_back(f.end);
+
+        switch (f.kind) {
+        case NK_REAL:
+            if (f.a >= flat.reals.size()) return false;
+            break;
+        case NK_STRING:
+            if (f.a >= flat.strings.size()) return false;
+            break;
+        case NK_VAR_DECL:
+        case NK_PARAM:
+            if (f.a >= flat.lists.size() || flat.lists[f.a] > flat.lists.size() - f.a - 1) return false;
+            break;
+        default:
+            break;
+        }
+    }
+    bool namesOk = true;
+    const_cast<FlatAST &>(flat).forEachSymbol([&](uint32_t &id) {
+        if (id >= nameCount) namesOk = false;
+    });
+    return namesOk;
+}
+
+bool loadCompile(const string &path, uint64_t key, Arena &arena, CachedCompile &out) {
+    MappedFile file;
+    if (!file.open(path) || file.size < sizeof(CacheHeader)) return false;
+
+    CacheHeader header;
+    memcpy(&header, file.data, sizeof(header));
+    if (memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 || header.version != CACHE_VERSION ||
+        header.byteOrder != CACHE_BYTE_ORDER || header.key != key || !sectionsFit(header, file.size))
+        return false;
+    Hasher sum;
+    sum.bytes(file.data + sizeof(CacheHeader), file.size - sizeof(CacheHeader));
+    if (sum.result() != header.checksum) return false;
+
+    Span<const char> text = section<char>(file, header, SEC_TEXT);
+    auto textOf = [&](TextRef ref, string_view &s) {
+        if (ref.offset > text.size() || ref.length > text.size() - ref.offset) return false;
+        s = string_view(text.begin() + ref.offset, ref.length);
+        return true;
+    };
+
+    // Names first: the file's name indices become this process's symbols
+    Span<const TextRef> nameRefs = section<TextRef>(file, header, SEC_NAMES);
+    vector<uint32_t> symbols;
+    for (const TextRef &ref : nameRefs) {
+        string_view s;
+        if (!textOf(ref, s)) return false;
+        symbols.push_back(intern(s).id);
+    }
+
+    FlatAST flat;
+    Span<const FlatNode> nodes = section<FlatNode>(file, header, SEC_NODES);
+    Span<const FlatDecoration> decorations = section<FlatDecoration>(file, header, SEC_DECORATIONS);
+    Span<const double> reals = section<double>(file, header, SEC_REALS);
+    Span<const uint32_t> lists = section<uint32_t>(file, header, SEC_LISTS);
+    flat.nodes.assign(nodes.begin(), nodes.end());
+    flat.decorations.assign(decorations.begin(), decorations.end());
+    flat.reals.assign(reals.begin(), reals.end());
+    flat.lists.assign(lists.begin(), lists.end());
+    for (const TextRef &ref : section<TextRef>(file, header, SEC_STRINGS)) {
+        string_view s;
+        if (!textOf(ref, s)) return false;
+        flat.strings.push_back(arena.copyString(s));
+    }
+    if (!wellFormed(flat, symbols.size())) return false;
+    flat.forEachSymbol([&](uint32_t &id) { id = symbols[id]; });
+
+    vector<TabEntry> tabs;
+    for (const CachedTabEntry &e : section<CachedTabEntry>(file, header, SEC_TAB)) {
+        if (e.name >= symbols.size()) return false;
+        tabs.push_back(TabEntry{Symbol(symbols[e.name]), e.link, e.obj, e.type, e.ref,
+                                e.nrm, e.lev, e.adr, e.initialized != 0});
+    }
+    vector<Diagnostic> diagnostics;
+    for (const CachedDiagnostic &d : section<CachedDiagnostic>(file, header, SEC_DIAGNOSTICS)) {
+        string_view s;
+        if (!textOf(d.text, s)) return false;
+        diagnostics.push_back(Diagnostic{d.at, string(s)});
+    }
+
+    // Nothing can fail from here on
+    Span<const BtabEntry> blocks = section<BtabEntry>(file, header, SEC_BTAB);
+    Span<const AtabEntry> arrays = section<AtabEntry>(file, header, SEC_ATAB);
+    tab = move(tabs);
+    btab.assign(blocks.begin(), blocks.end());
+    atab.assign(arrays.begin(), arrays.end());
+
+    out.ast = expandAST(flat, arena);
+    out.completed = header.completed != 0;
+    out.diagnostics = move(diagnostics);
+    return true;
+}
+
+// ========== DIAGNOSTICS ==========
+
+StreamTap::StreamTap(ostream &stream) : stream(stream), target(stream.rdbuf(this)) {}
+
+StreamTap::~StreamTap() {
+    stream.rdbuf(target);
+}
+
+int StreamTap::overflow(int c) {
+    if (c == traits_type::eof()) return traits_type::not_eof(c);
+    char ch = (char)c;
+    return xsputn(&ch, 1) == 1 ? c : traits_type::eof();
+}
+
+streamsize StreamTap::xsputn(const char *s, streamsize n) {
+    written(s, (size_t)n);
+    return target->sputn(s, n);
+}
+
+int StreamTap::sync() {
+    return target->pubsync();
+}
+
+DiagnosticCapture::DiagnosticCapture(bool enabled) {
+    if (!enabled) return;
+    out = make_unique<Counter>(cout);
+    err = make_unique<Recorder>(cerr, *out, runs);
+}
+
+void DiagnosticCapture::Recorder::written(const char *s, size_t n) {
+    if (runs.empty() || runs.back().at != out.bytes) runs.push_back(Diagnostic{out.bytes, ""});
+    runs.back().text.append(s, n);
+}
+
+DiagnosticReplay::DiagnosticReplay(const vector<Diagnostic> &diagnostics)
+    : StreamTap(cout), diagnostics(diagnostics) {}
+
+DiagnosticReplay::~DiagnosticReplay() {
+    bytes = UINT64_MAX;                     // whatever is left
+    printDue();
+}
+
+void DiagnosticReplay::printDue() {
+    while (next < diagnostics.size() && diagnostics[next].at <= bytes) {
+        target->pubsync();
+        cerr << diagnostics[next++].text;
+    }
+}
+
+streamsize DiagnosticReplay::xsputn(const char *s, streamsize n) {
+    streamsize done = 0;
+    while (done < n) {
+        printDue();
+        streamsize part = n - done;
+        if (next < diagnostics.size()) part = (streamsize)min<uint64_t>((uint64_t)part, diagnostics[next].at - bytes);
+        streamsize put = target->sputn(s + done, part);
+        bytes += (uint64_t)put;
+        done += put;
+        if (put < part) break;
+    }
+    return done;
+}
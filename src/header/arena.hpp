@@ -0,0 +1,89 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// Read-only view of n contiguous items, e.g. children packed in an Arena
+template <class T>
+struct Span {
+    T *items = nullptr;
+    size_t count = 0;
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    T &operator[](size_t i) const { return items[i]; }
+    T &back() const { return items[count - 1]; }
+    T *begin() const { return items; }
+    T *end() const { return items + count; }
+};
+
+// Bump allocator for data that dies all at once (one compile's parse tree
+// or AST). Objects are never destroyed individually, so only trivially
+// destructible types may live here; release() frees every block in one go.
+class Arena {
+public:
+    static const size_t BLOCK_SIZE = 64 * 1024;
+
+    Arena() = default;
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+    ~Arena() { release(); }
+
+    void *allocate(size_t bytes, size_t align = alignof(max_align_t)) {
+        size_t at = (used + align - 1) & ~(align - 1);
+        if (at + bytes > capacity) return allocateSlow(bytes, align);
+        used = at + bytes;
+        return current + at;
+    }
+
+    template <class T, class... Args>
+    T *make(Args &&...args) {
+        static_assert(is_trivially_destructible<T>::value, "arena objects are never destroyed");
+        return new (allocate(sizeof(T), alignof(T))) T(forward<Args>(args)...);
+    }
+
+    // Copy of items[0, n), contiguous
+    template <class T>
+    T *copyArray(const T *items, size_t n) {
+        static_assert(is_trivially_copyable<T>::value, "arena arrays are copied bytewise");
+        if (n == 0) return nullptr;
+        T *dst = static_cast<T *>(allocate(n * sizeof(T), alignof(T)));
+        memcpy(dst, items, n * sizeof(T));
+        return dst;
+    }
+
+    // The same, as a Span over a vector's items
+    template <class T>
+    Span<T> copySpan(const vector<T> &items) {
+        return Span<T>{copyArray(items.data(), items.size()), items.size()};
+    }
+
+    string_view copyString(string_view s) {
+        char *dst = static_cast<char *>(allocate(s.size(), 1));
+        memcpy(dst, s.data(), s.size());
+        return string_view(dst, s.size());
+    }
+
+    void release();
+    void adopt(Arena &other);       // takes over other's blocks, objects stay put
+    size_t bytesReserved() const { return reserved; }
+
+private:
+    void *allocateSlow(size_t bytes, size_t align);
+
+    vector<char *> blocks;
+    char *current = nullptr;
+    size_t used = 0;
+    size_t capacity = 0;
+    size_t reserved = 0;
+};
+
+#endif
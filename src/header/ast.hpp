@@ -3,105 +3,102 @@
 
 #include <string>
 #include <vector>
-#include <memory>
 #include "parser.hpp" 
 
 using std::string;
 using std::vector;
 
+// AST node kinds; passes dispatch on these, names are for printing only
+enum NodeKind : uint8_t {
+    NK_NUMBER, NK_REAL, NK_STRING, NK_CHAR, NK_BOOLEAN, NK_VAR, NK_ARRAY_ACCESS,
+    NK_BIN_OP, NK_UNARY_OP,
+    NK_ASSIGN, NK_PROCEDURE_CALL, NK_IF, NK_WHILE, NK_FOR,
+    NK_ARRAY_TYPE, NK_VAR_DECL, NK_CONST_DECL, NK_TYPE_DECL, NK_PARAM, NK_PROCEDURE_DECL, NK_FUNCTION_DECL,
+    NK_BLOCK, NK_DECLARATIONS, NK_PROGRAM,
+    NK_COUNT
+};
+
+const char *nodeKindName(NodeKind kind);   // "Number", "BinOp", ...
+
 // Forward declarations
+struct ASTNode;
 struct BlockNode;
 struct ParamNode;
 
+// Nodes live in the Arena handed to the builder and are never destroyed one
+// by one: names, types and operators are interned Symbols, string literals
+// and child lists are packed into the same arena, so the whole tree goes
+// away when the arena is released.
+
 struct ASTNode {
-    string nodeType;              // Jenis node 
-    string dataType;              // Hasil type checking 
+    NodeKind kind;                // Jenis node 
+    Symbol dataType;              // Hasil type checking 
     int symbolIndex = -1;         // Indeks ke tabel simbol 
     int scopeLevel = -1;          // Scope tempat node ini berada
 
-    vector<ASTNode*> children;
-
-    ASTNode(const string &type) : nodeType(type) {}
-    virtual ~ASTNode() {
-        for (auto child : children) {
-            delete child;
-        }
-    }
+    ASTNode(NodeKind k) : kind(k) {}
 };
 
 // Simple Literals
 
 struct NumberNode : ASTNode {
     int value;
-    NumberNode(int v) : ASTNode("Number"), value(v) {}
+    NumberNode(int v) : ASTNode(NK_NUMBER), value(v) {}
 };
 
 struct RealNode : ASTNode {
     double value;
-    RealNode(double v) : ASTNode("Real"), value(v) {}
+    RealNode(double v) : ASTNode(NK_REAL), value(v) {}
 };
 
 struct StringNode : ASTNode {
-    string value;
-    StringNode(const string &v) : ASTNode("String"), value(v) {}
+    string_view value;            // arena copy
+    StringNode(string_view v) : ASTNode(NK_STRING), value(v) {}
 };
 
 struct CharNode : ASTNode {
     char value;
-    CharNode(char v) : ASTNode("Char"), value(v) {}
+    CharNode(char v) : ASTNode(NK_CHAR), value(v) {}
 };
 
 struct BoolNode : ASTNode {
     bool value;
-    BoolNode(bool v) : ASTNode("Boolean"), value(v) {}
+    BoolNode(bool v) : ASTNode(NK_BOOLEAN), value(v) {}
 };
 
-// Identifier
+// Identifier (name is interned, see intern.hpp)
 
 struct VarNode : ASTNode {
-    string name;
-    VarNode(const string &n) : ASTNode("Var"), name(n) {}
+    Symbol name;
+    VarNode(Symbol n) : ASTNode(NK_VAR), name(n) {}
 };
 
 // Array Access
 struct ArrayAccessNode : ASTNode {
-    string arrayName;
+    Symbol arrayName;
     ASTNode* index;
     
-    ArrayAccessNode(const string &name, ASTNode* idx)
-        : ASTNode("ArrayAccess"), arrayName(name), index(idx) {}
-    
-    ~ArrayAccessNode() {
-        delete index;
-    }
+    ArrayAccessNode(Symbol name, ASTNode* idx)
+        : ASTNode(NK_ARRAY_ACCESS), arrayName(name), index(idx) {}
 };
 
 // Expressions
 
 struct BinOpNode : ASTNode {
-    string op;
+    Symbol op;
     ASTNode *left;
     ASTNode *right;
 
-    BinOpNode(const string &o, ASTNode* l, ASTNode* r)
-        : ASTNode("BinOp"), op(o), left(l), right(r) {}
-    
-    ~BinOpNode() {
-        delete left;
-        delete right;
-    }
+    BinOpNode(Symbol o, ASTNode* l, ASTNode* r)
+        : ASTNode(NK_BIN_OP), op(o), left(l), right(r) {}
 };
 
 struct UnaryOpNode : ASTNode {
-    string op;
+    Symbol op;
     ASTNode* operand;
     
-    UnaryOpNode(const string &o, ASTNode* operand)
-        : ASTNode("UnaryOp"), op(o), operand(operand) {}
-    
-    ~UnaryOpNode() {
-        delete operand;
-    }
+    UnaryOpNode(Symbol o, ASTNode* operand)
+        : ASTNode(NK_UNARY_OP), op(o), operand(operand) {}
 };
 
 // Statements
@@ -111,23 +108,14 @@ struct AssignNode : ASTNode {
     ASTNode* value;
 
     AssignNode(ASTNode* t, ASTNode* v)
-        : ASTNode("Assign"), target(t), value(v) {}
-    
-    ~AssignNode() {
-        delete target;
-        delete value;
-    }
+        : ASTNode(NK_ASSIGN), target(t), value(v) {}
 };
 
 struct ProcedureCallNode : ASTNode {
-    string procName;
-    vector<ASTNode*> args;
+    Symbol procName;
+    Span<ASTNode*> args;
 
-    ProcedureCallNode(const string &name) : ASTNode("ProcedureCall"), procName(name) {}
-    
-    ~ProcedureCallNode() {
-        for (auto arg : args) delete arg;
-    }
+    ProcedureCallNode(Symbol name) : ASTNode(NK_PROCEDURE_CALL), procName(name) {}
 };
 
 struct IfNode : ASTNode {
@@ -136,13 +124,7 @@ struct IfNode : ASTNode {
     ASTNode* elseBranch;
 
     IfNode(ASTNode* cond, ASTNode* t, ASTNode* e = nullptr)
-        : ASTNode("If"), condition(cond), thenBranch(t), elseBranch(e) {}
-    
-    ~IfNode() {
-        delete condition;
-        delete thenBranch;
-        if (elseBranch) delete elseBranch;
-    }
+        : ASTNode(NK_IF), condition(cond), thenBranch(t), elseBranch(e) {}
 };
 
 struct WhileNode : ASTNode {
@@ -150,12 +132,7 @@ struct WhileNode : ASTNode {
     ASTNode* body;
 
     WhileNode(ASTNode* cond, ASTNode* b)
-        : ASTNode("While"), condition(cond), body(b) {}
-    
-    ~WhileNode() {
-        delete condition;
-        delete body;
-    }
+        : ASTNode(NK_WHILE), condition(cond), body(b) {}
 };
 
 struct ForNode : ASTNode {
@@ -164,14 +141,7 @@ struct ForNode : ASTNode {
     bool ascending; // ke / turun-ke
 
     ForNode(ASTNode* ctr, ASTNode* s, ASTNode* e, ASTNode* b, bool asc)
-        : ASTNode("For"), counter(ctr), start(s), end(e), body(b), ascending(asc) {}
-    
-    ~ForNode() {
-        delete counter;
-        delete start;
-        delete end;
-        delete body;
-    }
+        : ASTNode(NK_FOR), counter(ctr), start(s), end(e), body(b), ascending(asc) {}
 };
 
 // Declarations
@@ -179,126 +149,92 @@ struct ForNode : ASTNode {
 struct ArrayTypeNode : ASTNode {
     ASTNode* rangeStart;
     ASTNode* rangeEnd;
-    string elementType;
-    
-    ArrayTypeNode(ASTNode* start, ASTNode* end, const string &elemType)
-        : ASTNode("ArrayType"), rangeStart(start), rangeEnd(end), elementType(elemType) {}
+    Symbol elementType;
     
-    ~ArrayTypeNode() {
-        delete rangeStart;
-        delete rangeEnd;
-    }
+    ArrayTypeNode(ASTNode* start, ASTNode* end, Symbol elemType)
+        : ASTNode(NK_ARRAY_TYPE), rangeStart(start), rangeEnd(end), elementType(elemType) {}
 };
 
 struct VarDeclNode : ASTNode {
-    vector<string> names;
-    string typeName;          
+    Span<Symbol> names;
+    Symbol typeName;          
     ArrayTypeNode* arrayType; 
 
-    VarDeclNode() : ASTNode("VarDecl"), arrayType(nullptr) {}
-    
-    ~VarDeclNode() {
-        if (arrayType) delete arrayType;
-    }
+    VarDeclNode() : ASTNode(NK_VAR_DECL), arrayType(nullptr) {}
 };
 
 struct ConstDeclNode : ASTNode {
-    string name;
+    Symbol name;
     ASTNode* value;
     
-    ConstDeclNode(const string &n, ASTNode* v)
-        : ASTNode("ConstDecl"), name(n), value(v) {}
-    
-    ~ConstDeclNode() {
-        delete value;
-    }
+    ConstDeclNode(Symbol n, ASTNode* v)
+        : ASTNode(NK_CONST_DECL), name(n), value(v) {}
 };
 
 struct TypeDeclNode : ASTNode {
-    string name;
-    string definition;      
+    Symbol name;
+    Symbol definition;      
     ArrayTypeNode* arrayType; 
     
-    TypeDeclNode(const string &n, const string &def)
-        : ASTNode("TypeDecl"), name(n), definition(def), arrayType(nullptr) {}
-    
-    ~TypeDeclNode() {
-        if (arrayType) delete arrayType;
-    }
+    TypeDeclNode(Symbol n, Symbol def = Symbol())
+        : ASTNode(NK_TYPE_DECL), name(n), definition(def), arrayType(nullptr) {}
 };
 
 struct ParamNode : ASTNode {
-    vector<string> names;
-    string typeName;
+    Span<Symbol> names;
+    Symbol typeName;
     bool isVar;  // true if "var" parameter
     
-    ParamNode() : ASTNode("Param"), isVar(false) {}
+    ParamNode() : ASTNode(NK_PARAM), isVar(false) {}
 };
 
 struct ProcedureDeclNode : ASTNode {
-    string name;
-    vector<ParamNode*> params;
+    Symbol name;
+    Span<ParamNode*> params;
     BlockNode* body;
     
-    ProcedureDeclNode(const string &n)
-        : ASTNode("ProcedureDecl"), name(n), body(nullptr) {}
-    
-    ~ProcedureDeclNode();
+    ProcedureDeclNode(Symbol n)
+        : ASTNode(NK_PROCEDURE_DECL), name(n), body(nullptr) {}
 };
 
 struct FunctionDeclNode : ASTNode {
-    string name;
-    vector<ParamNode*> params;
-    string returnType;
+    Symbol name;
+    Span<ParamNode*> params;
+    Symbol returnType;
     BlockNode* body;
     
-    FunctionDeclNode(const string &n, const string &retType)
-        : ASTNode("FunctionDecl"), name(n), returnType(retType), body(nullptr) {}
-    
-    ~FunctionDeclNode();
+    FunctionDeclNode(Symbol n, Symbol retType)
+        : ASTNode(NK_FUNCTION_DECL), name(n), returnType(retType), body(nullptr) {}
 };
 
 struct BlockNode : ASTNode {
-    vector<ASTNode*> declarations;  // const, type, var, subprogram declarations
-    vector<ASTNode*> statements;
-    
-    BlockNode() : ASTNode("Block") {}
+    Span<ASTNode*> declarations;    // const, type, var, subprogram declarations
+    Span<ASTNode*> statements;
     
-    ~BlockNode() {
-        for (auto d : declarations) delete d;
-        for (auto s : statements) delete s;
-    }
+    BlockNode() : ASTNode(NK_BLOCK) {}
 };
 
 struct DeclarationsNode : ASTNode {
-    vector<ASTNode*> declarations;
+    Span<ASTNode*> declarations;
     
-    DeclarationsNode() : ASTNode("Declarations") {}
-    
-    ~DeclarationsNode() {
-        for (auto d : declarations) delete d;
-    }
+    DeclarationsNode() : ASTNode(NK_DECLARATIONS) {}
 };
 
 // Program Root
 
 struct ProgramNode : ASTNode {
-    string name;
+    Symbol name;
     DeclarationsNode* declarations;
     BlockNode* block;
 
-    ProgramNode(const string &n)
-        : ASTNode("Program"), name(n), declarations(nullptr), block(nullptr) {}
-    
-    ~ProgramNode() {
-        if (declarations) delete declarations;
-        if (block) delete block;
-    }
+    ProgramNode(Symbol n)
+        : ASTNode(NK_PROGRAM), name(n), declarations(nullptr), block(nullptr) {}
 };
 
 // Function declarations
-ASTNode* buildAST(ParseNode* root);
-ASTNode* ASTMain(ParseNode* parseRoot);
+ASTNode* buildAST(ParseNode* root, Arena &arena);
+ASTNode* ASTMain(ParseNode* parseRoot, Arena &arena);   // buildAST, then showAST
+ASTNode* showAST(ASTNode* ast);               // prints the AST, null-checked
 void printAST(ASTNode* node, const string& prefix = "", bool isLast = true);
 
 #endif
\ No newline at end of file
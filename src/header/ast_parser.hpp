@@ -0,0 +1,74 @@
+#ifndef AST_PARSER_HPP
+#define AST_PARSER_HPP
+
+#include "parser.hpp"
+#include "ast.hpp"
+
+using namespace std;
+
+// Binary operator precedence, loosest first; 0 = not a binary operator
+enum Precedence {
+	PREC_NONE = 0,
+	PREC_RELATIONAL,      // = <> < <= > >=, at most one per expression
+	PREC_ADDITIVE,        // + - atau, and a leading sign
+	PREC_MULTIPLICATIVE,  // * / bagi mod dan
+	PREC_FACTOR
+};
+
+// Parses straight into the AST, skipping the concrete parse tree. Produces
+// the same AST and diagnostics as buildAST(Parser(...).parse()), including
+// its error-path shapes, so the two paths stay interchangeable. The one
+// message buildAST prints while lowering, for a boolean word other than
+// benar/salah, comes here in source order with the syntax errors. Nodes are
+// allocated in the Arena passed in, which also keeps the ones left out of
+// the tree; the AST is freed by releasing it.
+class ASTParser : public ParserBase {
+public:
+	ASTParser(Lexer &lexer, Arena &arena, bool debug = false, ostream &diag = cerr);
+
+	ProgramNode* parse();                     // whole program, then expect EOF; null if too deep
+
+private:
+	// A parsed <type>; head is what parameters and return types record
+	struct TypeSpec {
+		string name;                          // ex: "integer", "larik[...] dari char"
+		string head;                          // keyword, "<array-type>" or ""
+		ArrayTypeNode* array = nullptr;       // array types only
+	};
+
+	void parseAhead();                        // top-level subprograms, into per-worker arenas
+	void declarations(vector<ASTNode*> &out, bool topLevel);
+	void constDeclaration(vector<ASTNode*> &out, bool topLevel);
+	void typeDeclaration(vector<ASTNode*> &out, bool topLevel);
+	void varDeclaration(vector<ASTNode*> &out);
+	TypeSpec typeSpec();
+	TypeSpec arrayType();
+	ASTNode* subprogram();
+	ProcedureDeclNode* procedureDeclaration();
+	FunctionDeclNode* functionDeclaration();
+	Span<ParamNode*> formalParameters();
+	vector<Symbol> identifierList();
+	BlockNode* block();
+	BlockNode* compoundStatement();
+	ASTNode* statement();
+	ASTNode* assignment();
+	ASTNode* ifStatement();
+	ASTNode* whileStatement();
+	ASTNode* forStatement();
+	ProcedureCallNode* call();
+	ASTNode* expression(int minPrecedence = PREC_RELATIONAL);
+	ASTNode* factor();
+
+	// buildAST never visits function bodies or subprograms nested in a
+	// block; they are still parsed for their diagnostics, but with keep off
+	bool keep = true;
+
+	Arena &arena;
+	vector<ASTNode*> aheadNodes;              // by slice
+};
+
+// Parses a whole program with the given error and nesting caps
+ProgramNode* parseAST(Lexer &input, Arena &arena, unsigned maxErrors = DEFAULT_MAX_ERRORS,
+                      unsigned maxDepth = DEFAULT_MAX_DEPTH);
+
+#endif
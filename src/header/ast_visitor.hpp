@@ -0,0 +1,252 @@
+#ifndef AST_VISITOR_HPP
+#define AST_VISITOR_HPP
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "ast.hpp"
+
+using namespace std;
+
+// Base for AST passes, dispatched at compile time (CRTP): a pass derives
+// from ASTVisitor<Pass> and declares hooks for the node types it cares
+// about. walk() switches on the node's kind once and calls the pass's
+// hooks on the concrete type; there are no virtual calls.
+//
+//   bool enter(XNode*)          pre-order; false skips the children and leave
+//   void walkChildren(XNode*)   default: every child in source order; declare
+//                               one to reorder, filter or interleave checks
+//   void leave(XNode*)          post-order
+//
+// Hooks on ASTNode* (or templates) catch every type not matched exactly.
+// Declaring any hook hides the base's overloads of that name, so a pass
+// that keeps the defaults for other types adds
+// `using ASTVisitor<Pass>::enter;` (likewise leave, walkChildren). Hooks
+// may be protected or private if the pass befriends ASTVisitor<Pass>.
+// Calling stop() ends the walk: no hook runs after it.
+//
+// An operator chain nests one BinOp per operator down the left operands,
+// and the parser's nesting budget does not bound its length, so walk()
+// follows that left spine in a loop. For a BinOp, walkChildren is split
+// around the left operand, which walk() visits itself:
+//
+//   bool walkLeft(BinOpNode*)   before the left operand; false skips it
+//   void walkRight(BinOpNode*)  after it; default: the right operand
+template <class Derived>
+class ASTVisitor {
+public:
+    // Walks the subtree under node; false once the walk has been stopped
+    bool walk(ASTNode* node) {
+        if (!node || halted) return !halted;
+        switch (node->kind) {
+        case NK_NUMBER:         visit(static_cast<NumberNode*>(node)); break;
+        case NK_REAL:           visit(static_cast<RealNode*>(node)); break;
+        case NK_STRING:         visit(static_cast<StringNode*>(node)); break;
+        case NK_CHAR:           visit(static_cast<CharNode*>(node)); break;
+        case NK_BOOLEAN:        visit(static_cast<BoolNode*>(node)); break;
+        case NK_VAR:            visit(static_cast<VarNode*>(node)); break;
+        case NK_ARRAY_ACCESS:   visit(static_cast<ArrayAccessNode*>(node)); break;
+        case NK_BIN_OP:         visit(static_cast<BinOpNode*>(node)); break;
+        case NK_UNARY_OP:       visit(static_cast<UnaryOpNode*>(node)); break;
+        case NK_ASSIGN:         visit(static_cast<AssignNode*>(node)); break;
+        case NK_PROCEDURE_CALL: visit(static_cast<ProcedureCallNode*>(node)); break;
+        case NK_IF:             visit(static_cast<IfNode*>(node)); break;
+        case NK_WHILE:          visit(static_cast<WhileNode*>(node)); break;
+        case NK_FOR:            visit(static_cast<ForNode*>(node)); break;
+        case NK_ARRAY_TYPE:     visit(static_cast<ArrayTypeNode*>(node)); break;
+        case NK_VAR_DECL:       visit(static_cast<VarDeclNode*>(node)); break;
+        case NK_CONST_DECL:     visit(static_cast<ConstDeclNode*>(node)); break;
+        case NK_TYPE_DECL:      visit(static_cast<TypeDeclNode*>(node)); break;
+        case NK_PARAM:          visit(static_cast<ParamNode*>(node)); break;
+        case NK_PROCEDURE_DECL: visit(static_cast<ProcedureDeclNode*>(node)); break;
+        case NK_FUNCTION_DECL:  visit(static_cast<FunctionDeclNode*>(node)); break;
+        case NK_BLOCK:          visit(static_cast<BlockNode*>(node)); break;
+        case NK_DECLARATIONS:   visit(static_cast<DeclarationsNode*>(node)); break;
+        case NK_PROGRAM:        visit(static_cast<ProgramNode*>(node)); break;
+        default:                break;
+        }
+        return !halted;
+    }
+
+protected:
+    bool enter(ASTNode*) { return true; }
+    void leave(ASTNode*) {}
+
+    template <class T>
+    void walkChildren(T* node) {
+        eachChild(node, [this](ASTNode* child, bool) { walk(child); });
+    }
+
+    bool walkLeft(BinOpNode*) { return true; }
+    void walkRight(BinOpNode* node) { walk(node->right); }
+
+    void stop() { halted = true; }
+    bool stopped() const { return halted; }
+
+    // Calls f(child, isLast) on the children of node in source order, isLast
+    // meaning nothing follows. Absent single children are skipped; list
+    // entries are passed as they are.
+    template <class F>
+    static void eachChild(ASTNode*, F) {}
+    template <class F>
+    static void eachChild(ArrayAccessNode* node, F f) { slots(f, node->index); }
+    template <class F>
+    static void eachChild(BinOpNode* node, F f) { slots(f, node->left, node->right); }
+    template <class F>
+    static void eachChild(UnaryOpNode* node, F f) { slots(f, node->operand); }
+    template <class F>
+    static void eachChild(AssignNode* node, F f) { slots(f, node->target, node->value); }
+    template <class F>
+    static void eachChild(ProcedureCallNode* node, F f) { list(f, node->args, false); }
+    template <class F>
+    static void eachChild(IfNode* node, F f) { slots(f, node->condition, node->thenBranch, node->elseBranch); }
+    template <class F>
+    static void eachChild(WhileNode* node, F f) { slots(f, node->condition, node->body); }
+    template <class F>
+    static void eachChild(ForNode* node, F f) { slots(f, node->counter, node->start, node->end, node->body); }
+    template <class F>
+    static void eachChild(ArrayTypeNode* node, F f) { slots(f, node->rangeStart, node->rangeEnd); }
+    template <class F>
+    static void eachChild(VarDeclNode* node, F f) { slots(f, node->arrayType); }
+    template <class F>
+    static void eachChild(ConstDeclNode* node, F f) { slots(f, node->value); }
+    template <class F>
+    static void eachChild(TypeDeclNode* node, F f) { slots(f, node->arrayType); }
+    template <class F>
+    static void eachChild(ProcedureDeclNode* node, F f) {
+        list(f, node->params, node->body != nullptr);
+        slots(f, node->body);
+    }
+    template <class F>
+    static void eachChild(FunctionDeclNode* node, F f) {
+        list(f, node->params, node->body != nullptr);
+        slots(f, node->body);
+    }
+    template <class F>
+    static void eachChild(BlockNode* node, F f) {
+        list(f, node->declarations, !node->statements.empty());
+        list(f, node->statements, false);
+    }
+    template <class F>
+    static void eachChild(DeclarationsNode* node, F f) { list(f, node->declarations, false); }
+    template <class F>
+    static void eachChild(ProgramNode* node, F f) { slots(f, node->declarations, node->block); }
+
+private:
+    template <class T>
+    void visit(T* node) {
+        Derived &pass = static_cast<Derived &>(*this);
+        if (!pass.enter(node) || halted) return;
+        pass.walkChildren(node);
+        if (!halted) pass.leave(node);
+    }
+
+    // Enters the spine top-down, walks the first operand, then finishes each
+    // BinOp bottom-up; spine is shared by nested chains
+    void visit(BinOpNode* node) {
+        Derived &pass = static_cast<Derived &>(*this);
+        size_t base = spine.size();
+        ASTNode* left = node;
+        while (left && left->kind == NK_BIN_OP) {
+            BinOpNode* op = static_cast<BinOpNode*>(left);
+            if (!pass.enter(op) || halted) {
+                left = nullptr;
+                break;
+            }
+            spine.push_back(op);
+            left = pass.walkLeft(op) ? op->left : nullptr;
+        }
+        walk(left);
+        while (spine.size() > base) {
+            BinOpNode* op = spine.back();
+            spine.pop_back();
+            if (halted) continue;
+            pass.walkRight(op);
+            if (!halted) pass.leave(op);
+        }
+    }
+
+    template <class F, class... Nodes>
+    static void slots(F &f, Nodes*... nodes) {
+        ASTNode* children[] = {nodes...};
+        size_t last = sizeof...(Nodes);
+        while (last > 0 && !children[last - 1]) last--;
+        for (size_t i = 0; i < last; i++) {
+            if (children[i]) f(children[i], i + 1 == last);
+        }
+    }
+
+    template <class F, class T>
+    static void list(F &f, Span<T*> items, bool more) {
+        for (size_t i = 0; i < items.size(); i++) f(items[i], !more && i + 1 == items.size());
+    }
+
+    vector<BinOpNode*> spine;                 // BinOps whose left operand is being walked
+    bool halted = false;
+};
+
+// Base for passes that print the tree, one line per node under box-drawing
+// prefixes. The pass prints its line in enter(), starting with line();
+// children go through nest(), by default all of them except parameters,
+// which belong to their declaration's line. The prefix is one buffer that
+// grows and shrinks with the walk, so a deep tree costs no prefix copies.
+template <class Derived>
+class ASTTreePrinter : public ASTVisitor<Derived> {
+public:
+    ASTTreePrinter(const string &prefix, bool isLast) : prefix(prefix), isLast(isLast) {}
+
+    template <class T>
+    void walkChildren(T* node) {
+        this->eachChild(node, [&](ASTNode* child, bool last) {
+            if (!child || child->kind != NK_PARAM) nest(child, last);
+        });
+    }
+
+    bool walkLeft(BinOpNode* node) {
+        open(!node->right);
+        return true;
+    }
+
+    void walkRight(BinOpNode* node) {
+        close();
+        if (node->right) nest(node->right, true);
+    }
+
+protected:
+    void line() const { cout << prefix << (isLast ? "└── " : "├── "); }
+    const char* indent() const { return isLast ? "    " : "│   "; }   // under this node's line
+
+    // Prints child as a subtree under this node's line, its root line
+    // indented further by extra
+    void nest(ASTNode* child, bool last, const char* extra = "") {
+        open(last, extra);
+        this->walk(child);
+        close();
+    }
+
+    // nest() in halves: open() moves to the child's line, close() back
+    void open(bool last, const char* extra = "") {
+        levels.push_back({prefix.size(), isLast});
+        prefix += indent();
+        prefix += extra;
+        isLast = last;
+    }
+
+    void close() {
+        prefix.resize(levels.back().length);
+        isLast = levels.back().isLast;
+        levels.pop_back();
+    }
+
+    string prefix;
+    bool isLast;
+
+private:
+    struct Level {
+        size_t length;
+        bool isLast;
+    };
+    vector<Level> levels;                     // one per open()
+};
+
+#endif
@@ -26,6 +26,7 @@ void semanticWarning(const string& message);
 string getTypeName(int typeCode);
 
 int getTypeCode(const string& typeName);
+int getTypeCode(Symbol typeName);             // same, for names kept in the AST
 int getTypeSize(int typeCode);
 int getLowerBound(ASTNode* rangeStart);
 int getUpperBound(ASTNode* rangeEnd);
@@ -0,0 +1,121 @@
+#ifndef COMPILE_CACHE_HPP
+#define COMPILE_CACHE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ast.hpp"
+#include "dfa.hpp"
+
+using namespace std;
+
+// On-disk cache of finished compiles: the decorated AST in its flat layout
+// (flat_ast.hpp), tab, btab, atab and the compile's diagnostics. A file is
+// one header followed by 8-byte aligned arrays of fixed-size records, so it
+// is mmap'ed and read in place; names are stored as text and interned again
+// on load. Bump CACHE_VERSION whenever the layout changes; changes to the
+// compiler's output are covered by COMPILER_BUILD_ID.
+const uint32_t CACHE_VERSION = 2;
+
+// A hash of the compiler's sources, passed in by the Makefile, so a rebuilt
+// compiler never reads entries an older one wrote
+#ifndef COMPILER_BUILD_ID
+#define COMPILER_BUILD_ID 0
+#endif
+
+// Identifies one compile: cache version, build, source text, lexer rules
+// and the limits that change diagnostics
+uint64_t compileKey(string_view source, const LexerRules &rules, unsigned maxErrors, unsigned maxDepth);
+string cachePath(const string &dir, uint64_t key);    // dir/<key in hex>.pasc
+
+// A run of text the compile wrote to cerr, and where it fell in its cout
+struct Diagnostic {
+    uint64_t at;                            // cout bytes written before it
+    string text;
+};
+
+// What a hit brings back
+struct CachedCompile {
+    ASTNode* ast = nullptr;                 // decorated, in the arena given to loadCompile
+    bool completed = false;                 // semantic analysis ran to the end
+    vector<Diagnostic> diagnostics;         // everything the compile wrote to cerr, in order
+};
+
+// Rebuilds the compile stored at path into arena, tab, btab and atab. False
+// on a miss: no file, another key or version, or a damaged file.
+bool loadCompile(const string &path, uint64_t key, Arena &arena, CachedCompile &out);
+
+// Stores ast and the current tables. Written aside and renamed into place,
+// so concurrent compiles never see a partial file; false if it could not be.
+bool saveCompile(const string &path, uint64_t key, ASTNode* ast, bool completed,
+                 const vector<Diagnostic> &diagnostics);
+
+// Stands in for a stream's buffer while alive, passing every write on to
+// the original after showing it to written()
+class StreamTap : public streambuf {
+public:
+    explicit StreamTap(ostream &stream);
+    virtual ~StreamTap();
+    StreamTap(const StreamTap &) = delete;
+    StreamTap &operator=(const StreamTap &) = delete;
+
+protected:
+    virtual void written(const char *, size_t) {}
+    int overflow(int c) override;
+    streamsize xsputn(const char *s, streamsize n) override;
+    int sync() override;
+
+    ostream &stream;
+    streambuf *target;                      // the stream's own buffer
+};
+
+// While alive, everything written to cerr is also kept in diagnostics(),
+// each run with the number of bytes cout had written before it
+class DiagnosticCapture {
+public:
+    explicit DiagnosticCapture(bool enabled = true);
+
+    const vector<Diagnostic> &diagnostics() const { return runs; }
+
+private:
+    struct Counter : StreamTap {
+        using StreamTap::StreamTap;
+        void written(const char *, size_t n) override { bytes += n; }
+        uint64_t bytes = 0;
+    };
+    struct Recorder : StreamTap {
+        Recorder(ostream &stream, const Counter &out, vector<Diagnostic> &runs)
+            : StreamTap(stream), out(out), runs(runs) {}
+        void written(const char *s, size_t n) override;
+        const Counter &out;
+        vector<Diagnostic> &runs;
+    };
+
+    vector<Diagnostic> runs;
+    unique_ptr<Counter> out;                // on cout, null when disabled
+    unique_ptr<Recorder> err;               // on cerr
+};
+
+// While alive, prints diagnostics to cerr as cout reaches the position each
+// was captured at, so a cache hit interleaves them as the compile did. The
+// rest are printed when it ends.
+class DiagnosticReplay : public StreamTap {
+public:
+    explicit DiagnosticReplay(const vector<Diagnostic> &diagnostics);
+    ~DiagnosticReplay() override;
+
+protected:
+    streamsize xsputn(const char *s, streamsize n) override;
+
+private:
+    void printDue();                        // every diagnostic at the current position
+
+    const vector<Diagnostic> &diagnostics;
+    size_t next = 0;
+    uint64_t bytes = 0;                     // cout bytes so far
+};
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef DFA_HPP
+#define DFA_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <unordered_set>
+#include "token.hpp"
+#include "runscan.hpp"
+
+using namespace std;
+
+// DFA rules compiled into integer states and a flat [state][byte] table.
+// Exact-character, class and 'any' fallbacks are already resolved, so the
+// lexer only needs one array load per input byte.
+struct DFATable {
+    static const int NO_STATE = -1;
+
+    int numStates = 0;
+    int startState = 0;
+    int identifierState = NO_STATE;   // accepted words go through keyword lookup
+    int errorState = NO_STATE;
+
+    vector<int16_t> next;             // next[state * 256 + byte], NO_STATE if no transition
+    vector<uint8_t> isFinal;          // isFinal[state]
+    vector<string> stateNames;        // original state names, for debugging
+    vector<uint8_t> tokenKind;        // TokenKind emitted by each final state
+    uint8_t skipInStart[256] = {};    // whitespace skipped while in the start state
+    vector<ByteRun> runs;             // runs[state], filled by computeRuns
+
+    int step(int state, unsigned char c) const { return next[state * 256 + c]; }
+};
+
+// State counts reported by the minimizer
+struct DFAStats {
+    int statesBefore = 0;
+    int statesReachable = 0;
+    int statesAfter = 0;
+};
+
+// Drop unreachable states and merge equivalent ones (Hopcroft)
+DFATable minimizeDFA(const DFATable &dfa, DFAStats *stats = nullptr);
+
+// Derive each state's self-loop bytes (skipInStart for the start state)
+void computeRuns(DFATable &dfa);
+
+// What an accepted identifier-shaped word really is
+enum WordClass : uint8_t {
+    WORD_IDENTIFIER = 0,
+    WORD_KEYWORD,
+    WORD_LOGICAL_OPERATOR,
+    WORD_ARITHMETIC_OPERATOR,
+    WORD_BOOLEAN
+};
+
+inline uint32_t keywordHash(const char *s, size_t n, uint32_t seed) {
+    uint32_t h = 2166136261u ^ seed;
+    for (size_t i = 0; i < n; ++i) {
+        h ^= (unsigned char)s[i];
+        h *= 16777619u;
+    }
+    return h ^ (h >> 15);
+}
+
+// Perfect hash over the keyword_lookup words: every word owns its own slot,
+// so classification is one hash, one length check and one memcmp.
+struct KeywordTable {
+    uint32_t seed = 0;
+    uint32_t mask = 0;            // slot count - 1 (power of two)
+    vector<string> words;         // slot -> word, empty if unused
+    vector<uint8_t> classes;      // slot -> WordClass
+    vector<uint8_t> subs;         // slot -> Keyword / Operator id, 1 for benar
+
+    WordClass classify(const char *s, size_t n, uint8_t &sub) const {
+        uint32_t slot = keywordHash(s, n, seed) & mask;
+        const string &w = words[slot];
+        if (w.size() == n && memcmp(w.data(), s, n) == 0) {
+            sub = subs[slot];
+            return (WordClass)classes[slot];
+        }
+        sub = 0;
+        return WORD_IDENTIFIER;
+    }
+};
+
+// Words are given in priority order; a word already present keeps its first class
+KeywordTable buildKeywordTable(const vector<pair<string, WordClass>> &words);
+
+// Everything the lexer needs from rule.json
+struct LexerRules {
+    DFATable dfa;
+    KeywordTable words;
+};
+
+// Parse and minimize a rule.json file (used by tools/rulec and the --rules override)
+bool loadRulesFile(const string &path, LexerRules &out, DFAStats *stats = nullptr);
+
+// Tables compiled ahead of time from rule.json (see rules_gen.hpp)
+LexerRules builtinRules();
+
+#endif
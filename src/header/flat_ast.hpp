@@ -0,0 +1,129 @@
+#ifndef FLAT_AST_HPP
+#define FLAT_AST_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include "ast.hpp"
+
+using namespace std;
+
+// Flat copy of an AST: every node is a 16-byte record in one array, in
+// preorder, and is named by its 32-bit index. A node's subtree is the range
+// [i, end); its first child is i + 1 and each child's end is the index of
+// its next sibling, so passes walk the tree as a linear scan.
+//
+// Children by kind. FK_EMPTY fills an absent slot of a node with several
+// fixed slots; a lone optional child is simply left out.
+//   ArrayAccess: index?           BinOp: left, right      UnaryOp: operand?
+//   Assign: target, value         ProcedureCall: args...  If: cond, then, else
+//   While: cond, body             For: counter, start, end, body
+//   ArrayType: start, end         VarDecl, TypeDecl: arrayType?
+//   ConstDecl: value?             ProcedureDecl, FunctionDecl: params..., body
+//   Block: declarations..., statements...
+//   Declarations: declarations... Program: declarations, block
+//
+// Payload a/b by kind; symbols are stored by id, and a name list at a is
+// lists[a] = n followed by n ids:
+//   Number, Char, Boolean: a = value
+//   Real, String: a = index into reals / strings
+//   Var, ArrayAccess, ProcedureCall, ConstDecl, ProcedureDecl, Program: a = name
+//   BinOp, UnaryOp: a = operator
+//   ArrayType: a = element type
+//   TypeDecl: a = name, b = definition
+//   VarDecl, Param: a = name list, b = type name
+//   FunctionDecl: a = name, b = return type
+//   Block: a = number of declarations (the rest are statements)
+
+const uint8_t FK_EMPTY = NK_COUNT;          // kind of an absent operand
+const uint8_t FF_ASCENDING = 1;             // For: ke, not turun-ke
+const uint8_t FF_VAR_PARAM = 2;             // Param: passed by reference
+
+struct FlatNode {
+    uint8_t kind;                           // NodeKind, or FK_EMPTY
+    uint8_t flags;
+    uint16_t reserved;
+    uint32_t end;                           // one past the last node of the subtree
+    uint32_t a, b;                          // payload, see above
+};
+static_assert(sizeof(FlatNode) == 16, "four nodes per cache line");
+
+// Decorations from semantic analysis, by node
+struct FlatDecoration {
+    Symbol dataType;
+    int symbolIndex = -1;
+    int scopeLevel = -1;
+};
+
+class FlatAST {
+public:
+    vector<FlatNode> nodes;                 // preorder, root first
+    vector<FlatDecoration> decorations;     // parallel to nodes
+    vector<double> reals;
+    vector<string_view> strings;            // point where the AST's do
+    vector<uint32_t> lists;
+
+    // Children of node i, first to last
+    struct Children {
+        const FlatAST *ast;
+        uint32_t first, last;
+
+        struct Iter {
+            const FlatAST *ast;
+            uint32_t at;
+            uint32_t operator*() const { return at; }
+            Iter &operator++() { at = ast->nodes[at].end; return *this; }
+            bool operator!=(const Iter &o) const { return at != o.at; }
+        };
+        Iter begin() const { return Iter{ast, first}; }
+        Iter end() const { return Iter{ast, last}; }
+    };
+
+    uint32_t size() const { return (uint32_t)nodes.size(); }
+    bool empty() const { return nodes.empty(); }
+    bool hasChildren(uint32_t i) const { return nodes[i].end > i + 1; }
+    Children children(uint32_t i) const { return Children{this, i + 1, nodes[i].end}; }
+    Span<const uint32_t> nameList(uint32_t at) const {
+        return Span<const uint32_t>{lists.data() + at + 1, lists[at]};
+    }
+
+    // Calls f(uint32_t &id) on every stored symbol id, decorations included,
+    // e.g. to renumber them for another process
+    template <class F>
+    void forEachSymbol(F f) {
+        for (uint32_t i = 0; i < size(); i++) {
+            FlatNode &n = nodes[i];
+            switch (n.kind) {
+            case NK_VAR: case NK_ARRAY_ACCESS: case NK_BIN_OP: case NK_UNARY_OP:
+            case NK_PROCEDURE_CALL: case NK_ARRAY_TYPE: case NK_CONST_DECL:
+            case NK_PROCEDURE_DECL: case NK_PROGRAM:
+                f(n.a);
+                break;
+            case NK_TYPE_DECL: case NK_FUNCTION_DECL:
+                f(n.a);
+                f(n.b);
+                break;
+            case NK_VAR_DECL: case NK_PARAM:
+                for (uint32_t k = 0; k < lists[n.a]; k++) f(lists[n.a + 1 + k]);
+                f(n.b);
+                break;
+            default:
+                break;
+            }
+            f(decorations[i].dataType.id);
+        }
+    }
+};
+
+// Flattens the tree under root, decorations included. Iterative, so any
+// depth the parser accepted is fine.
+FlatAST flattenAST(ASTNode* root);
+
+// Pointer AST equal to the one flattened, decorations included, allocated in
+// arena. Built from the last node back, so it does not recurse either.
+ASTNode* expandAST(const FlatAST& ast, Arena &arena);
+
+// One line per node, in array order, indented by depth
+void printFlatAST(const FlatAST& ast);
+
+#endif
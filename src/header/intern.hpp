@@ -0,0 +1,33 @@
+#ifndef INTERN_HPP
+#define INTERN_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+using namespace std;
+
+// An interned identifier spelling. Every distinct spelling gets one 32-bit
+// id for the whole process, so names compare as integers. The spelling is
+// only looked up again for diagnostics and printing. Id 0 is the empty name.
+struct Symbol {
+    uint32_t id = 0;
+
+    Symbol() = default;
+    explicit Symbol(uint32_t id) : id(id) {}
+
+    bool empty() const { return id == 0; }
+    bool operator==(Symbol o) const { return id == o.id; }
+    bool operator!=(Symbol o) const { return id != o.id; }
+
+    string_view str() const;
+    string text() const { return string(str()); }
+};
+
+// Id of `spelling`, adding it on first use. Thread-safe.
+Symbol intern(string_view spelling);
+
+inline ostream &operator<<(ostream &out, Symbol s) { return out << s.str(); }
+
+#endif
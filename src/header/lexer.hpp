@@ -8,28 +8,107 @@
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
-#include "json.hpp"
+#include <string_view>
+#include "dfa.hpp"
+#include "token.hpp"
+#include "intern.hpp"
 
-using json = nlohmann::json;
 using namespace std;
 
+// Tokens do not own their text: the lexeme is [offset, offset + length)
+// of the source buffer, which stays alive for the whole compile.
 struct Token {
-    string type;
-    string lexeme;
+    TokenKind kind;
+    uint8_t sub;        // Keyword / Operator id, 1 for benar
+    uint32_t offset;
+    uint32_t length;
     int line;
     int column;
+    Symbol sym;         // interned spelling of an IDENTIFIER
 };
 
-unordered_map<char, string> buildCharMap(const json &charClasses);
-string classifyChar(char c, const unordered_map<char, string> &charMap);
-vector<Token> runDFA(
-    const string &input,
-    const json &rules,
-    const unordered_set<string> &keywords,
-    const unordered_set<string> &logical_ops,
-    const unordered_set<string> &arith_word_ops,
-    const unordered_set<string> &boolean_literals
-);
+extern thread_local string_view sourceText;  // buffer this thread's tokens point into
+
+inline string_view lexeme(const Token &t) { return sourceText.substr(t.offset, t.length); }
+inline const char *typeName(const Token &t) { return tokenKindName(t.kind); }
+
+inline bool isKeyword(const Token &t, Keyword kw) { return t.kind == TK_KEYWORD && t.sub == kw; }
+inline bool isOperator(const Token &t, Operator op) {
+    return (t.kind == TK_ARITHMETIC_OPERATOR || t.kind == TK_RELATIONAL_OPERATOR ||
+            t.kind == TK_LOGICAL_OPERATOR) && t.sub == op;
+}
+
+// Where lexing resumes: always between tokens, in the start state
+struct LexCursor {
+    size_t pos = 0;
+    int line = 1;
+    int column = 1;
+    bool done = false;
+    bool error = false;         // the last token returned was a lexical error
+    bool errorAtEnd = false;    // ... found at end of input
+    bool internNames = true;    // fill Token::sym for identifiers
+};
+
+bool lexToken(const LexerRules &rules, string_view input, LexCursor &cur, Token &out);
+
+// Inputs at least this big are lexed in batches of one chunk per thread.
+// The lexer then holds up to a batch of tokens ahead of the parser instead
+// of the lookahead window: hardware_concurrency() MB of source, at about
+// 10 MB of tokens per MB of source, however long the input is.
+const size_t PARALLEL_LEX_MIN_BYTES = 4u << 20;
+const size_t PARALLEL_LEX_MIN_CHUNK = 1u << 20;
+
+// Lex from `cur` to the first token boundary at or past `to`, split into up
+// to `chunks` pieces lexed concurrently, then stitched back together. Same
+// tokens (line/column included) as calling lexToken in a loop; `cur` ends
+// after the last token. Nothing is reported, the caller checks cur.error.
+vector<Token> lexParallel(string_view input, const LexerRules &rules, unsigned chunks, LexCursor &cur, size_t to);
+
+// Pull lexer: tokens are produced on demand and only the lookahead window
+// is buffered (a ring that grows when the parser peeks further ahead).
+// The parser's widest look-ahead, the scan for subprograms to parse in
+// parallel, stops at PARALLEL_PARSE_MAX_TOKENS (parser.hpp).
+// `input` becomes sourceText and must outlive the tokens.
+// input.data()[input.size()] must be a readable '\0' (std::string and
+// SourceFile both guarantee it), it stands for end of input.
+// After a lexical error the ERROR token is the last one before EOF.
+// Very large inputs are lexed in batches with lexParallel instead.
+class Lexer {
+public:
+    Lexer(string_view input, const LexerRules &rules, ostream *diag = &cerr);
+    Lexer(const Lexer &source, const vector<Token> &tokens);   // replays tokens of source's input, quietly
+    Lexer(const Lexer &) = delete;
+    Lexer &operator=(const Lexer &) = delete;
+
+    Token peek(size_t k = 0);   // k tokens ahead, EOF token past the end
+    Token scan(size_t k);       // peek that leaves a lexical error unreported until peek reaches it
+    Token next();
+    void restart();             // back to the first token; a reported error is not reported again
+    bool hadError() const { return cur.error; }
+
+private:
+    bool lexOne(Token &out);
+    bool lexBatch();            // appends the next parallel batch; false if not worth it
+    Token &slot(size_t k);      // ring slot k tokens ahead, growing the ring to fit
+    void report(const Token &t, bool atEnd);
+
+    string_view input;
+    const LexerRules &rules;
+    ostream *diag;              // lexical errors, nullptr to stay quiet
+
+    LexCursor cur;
+    bool unreported = false;    // the buffered error token was not reported yet
+    bool reported = false;      // the error was reported, maybe before a restart()
+
+    vector<Token> ring;         // capacity is a power of two
+    size_t head = 0;
+    size_t count = 0;
+    size_t upFront = 0;         // tokens buffered at construction, all of the input
+    unsigned chunks = 0;        // threads lexing a batch, 0: lex one token at a time
+};
+
+// Lex the whole input at once (token dump, lexer_main)
+vector<Token> runDFA(string_view input, const LexerRules &rules, ostream *diag = &cerr);
 int lexer_main(int argc, char* argv[]);
 
 #endif
\ No newline at end of file
@@ -2,69 +2,242 @@
 #define PARSER_HPP
 
 #include "lexer.hpp"
+#include "arena.hpp"
 #include <vector>
 #include <string>
 #include <iostream>
+#include <functional>
 using namespace std;
 
-extern vector<Token> tokens;
-extern int current;
-extern Token cur_tok;
-extern bool gDebug;
+// Parser tracing, fixed at compile time (make TRACE=1 sets it). At 0 the
+// trace calls compile to nothing; at 1 a Parser built with debug set
+// (--trace) prints every rule it enters and leaves and every match.
+#ifndef PARSE_TRACE
+#define PARSE_TRACE 0
+#endif
+constexpr bool TRACE_ENABLED = PARSE_TRACE > 0;
 
+// Parse node kinds. RK_TOKEN leaves carry the matched token; RK_MISSING
+// leaves stand for an expected token that was not there (tok.kind is the
+// expected kind). Labels like "<program>" are only made for printing.
+enum RuleKind : uint8_t {
+	RK_TOKEN = 0,
+	RK_MISSING,
+	RK_PROGRAM, RK_PROGRAM_HEADER, RK_DECLARATION_PART,
+	RK_CONST_DECLARATION, RK_TYPE_DECLARATION, RK_TYPE_DEFINITION,
+	RK_VAR_DECLARATION, RK_IDENTIFIER_LIST, RK_TYPE, RK_ARRAY_TYPE, RK_RANGE,
+	RK_SUBPROGRAM_DECLARATION, RK_PROCEDURE_DECLARATION, RK_FUNCTION_DECLARATION,
+	RK_FORMAL_PARAMETER_LIST, RK_PARAMETER_GROUP, RK_BLOCK,
+	RK_COMPOUND_STATEMENT, RK_STATEMENT_LIST, RK_STATEMENT,
+	RK_ASSIGNMENT_STATEMENT, RK_IF_STATEMENT, RK_WHILE_STATEMENT, RK_FOR_STATEMENT,
+	RK_CALL, RK_PARAMETER_LIST,
+	RK_EXPRESSION, RK_SIMPLE_EXPRESSION, RK_TERM, RK_FACTOR,
+	RK_RELATIONAL_OPERATOR, RK_ADDITIVE_OPERATOR, RK_MULTIPLICATIVE_OPERATOR,
+	RK_COUNT
+};
+
+const char *ruleName(RuleKind kind);       // "<program>", "" for leaves
+
+// Parse nodes and their child arrays live in the Arena passed to the
+// Parser; the tree is freed by releasing that arena.
 struct ParseNode {
-	string label;                 // ex: "<program>" or token like "IDENTIFIER(x)"
-	vector<ParseNode*> children;  
+	RuleKind rule;
+	Token tok;                    // token and missing nodes, kind TK_NONE otherwise
+	Span<ParseNode*> children;
+
+	bool isToken() const { return rule == RK_TOKEN; }
 };
 
-ParseNode* makeNode(const string &label);
-ParseNode* makeTokenNode(const Token &t);
-void addChild(ParseNode* parent, ParseNode* child);
+string nodeLabel(const ParseNode* node);   // token nodes print as "IDENTIFIER(x)"
 void printTree(ParseNode* node, const string &prefix = "", bool isLast = true);
 
-Token getCurrentToken();
-void advance();
-
-ParseNode* matchType(const string &expectedType);
-ParseNode* matchToken(const Token &expected);
-void debugEnter(const string &rule);
-void debugExit(const string &debugExit);
-
-ParseNode* program();
-ParseNode* program_header();
-ParseNode* declaration_part();
-ParseNode* const_declaration();
-ParseNode* type_declaration();
-ParseNode* type_definition();
-ParseNode* var_declaration();
-ParseNode* identifier_list();
-ParseNode* type_spec();
-ParseNode* array_type();
-ParseNode* range();
-ParseNode* subprogram_declaration();
-ParseNode* procedure_declaration();
-ParseNode* function_declaration();
-ParseNode* formal_parameter_list();
-ParseNode* parameter_group();
-ParseNode* block();
-ParseNode* compound_statement();
-ParseNode* statement_list();
-ParseNode* statement();
-ParseNode* assignment_statement();
-ParseNode* if_statement();
-ParseNode* while_statement();
-ParseNode* for_statement();
-ParseNode* procedure_function_call();
-ParseNode* parameter_list();
-ParseNode* expression();
-ParseNode* simple_expression();
-ParseNode* term();
-ParseNode* factor();
-ParseNode* relational_operator();
-ParseNode* additive_operator();
-ParseNode* multiplicative_operator();
-
-ParseNode* buildTree(vector<Token> inputTokens);
-ParseNode* parser_main(vector<Token> inputTokens);
+const unsigned DEFAULT_MAX_ERRORS = 20;    // syntax errors reported before giving up
+const unsigned DEFAULT_MAX_DEPTH = 1000;   // nesting levels before giving up
+
+// Programs with at least this many top-level subprograms parse them on
+// worker threads when there is more than one core, in batches that
+// buffer at most PARALLEL_PARSE_MAX_TOKENS tokens
+const size_t PARALLEL_PARSE_MIN_SUBPROGRAMS = 16;
+const size_t PARALLEL_PARSE_MAX_TOKENS = 1u << 16;
+
+// assignmentAhead() looks at most this far into a subscript
+const size_t SUBSCRIPT_SCAN_MAX_TOKENS = 64;
+
+// Token classes the parser may resynchronize on after a syntax error
+enum SyncSet : unsigned {
+	SYNC_SEMICOLON   = 1u << 0,   // ;
+	SYNC_STATEMENT   = 1u << 1,   // jika selama untuk selesai
+	SYNC_DECLARATION = 1u << 2,   // konstanta tipe variabel
+	SYNC_SUBPROGRAM  = 1u << 3,   // prosedur fungsi
+	SYNC_BODY        = 1u << 4    // mulai
+};
+
+// Token handling shared by the parsers: the current token, matching with
+// the standard syntax error messages, the lookahead decisions and panic-mode
+// recovery. After a syntax error further reports are dropped until the
+// parser resynchronizes at a statement or declaration boundary, so each
+// independent error is reported once.
+class ParserBase {
+public:
+	const Token &current() const { return cur; }
+	void setMaxErrors(unsigned n) { maxErrors = n; }   // 0 = no limit
+	void setMaxDepth(unsigned n) { maxDepth = n; }     // 0 = no limit
+	unsigned errorCount() const { return errors; }
+
+protected:
+	ParserBase(Lexer &lexer, bool debug, ostream &diag)
+		: lexer(lexer), cur(lexer.peek()), debug(debug), diag(diag) {}
+	ParserBase(const ParserBase &) = delete;
+	ParserBase &operator=(const ParserBase &) = delete;
+
+	void advance();
+	bool expectType(TokenKind expected);      // consume, or report and stay put
+	bool expectKeyword(Keyword kw);
+	bool acceptKeyword(Keyword kw);           // consume if present, silently
+	void reportAt(const char *message);       // message + "'lexeme' @ line:col"
+	void expectEnd();                         // nothing may follow the program
+	bool tracing() const { return TRACE_ENABLED && debug; }
+	void debugEnter(const char *rule) {
+		if constexpr (TRACE_ENABLED) if (debug) traceRule(">>> Entering rule: ", rule, "Current");
+	}
+	void debugExit(const char *rule) {
+		if constexpr (TRACE_ENABLED) if (debug) traceRule("<<< Exiting rule: ", rule, "Next");
+	}
+	void traceRule(const char *event, const char *rule, const char *which);
+
+	static bool isStatementStart(const Token &t);
+	bool assignmentAhead();                   // IDENTIFIER [subscript] :=
+
+	bool reportable();                        // false while panicking or past the cap
+	void reportUnexpected();
+	bool atEnd() const;                       // EOF, or the token a lexical error stopped at
+	void synchronize(unsigned stop);          // skip to a SyncSet token or the end
+	void resync() { panicking = false; }
+	bool recoverStatement();                  // statement not followed by ';'; true: parse another
+	bool recoverDeclarations();               // declaration-part not followed by mulai; true: more subprograms
+	bool expectEntryEnd();                    // ';' closing a declaration entry
+
+	// Nesting budget. Statements, blocks and factors (so parentheses, tidak,
+	// subscripts and calls) take one level, so every later phase recurses
+	// at most a bounded depth too. Operator chains are not nesting: they
+	// stay flat in the parse tree, and the AST passes follow the left spine
+	// they build in a loop (see ASTVisitor). Past the budget parsing stops
+	// with one diagnostic and parse() returns null.
+	bool enterNested();                       // false once past maxDepth
+	void leaveNested(unsigned levels = 1) { depth -= levels; }
+	struct Nested {                           // one level for a rule's extent
+		ParserBase &parser;
+		bool ok;
+		explicit Nested(ParserBase &p) : parser(p), ok(p.enterNested()) {}
+		~Nested() { if (ok) parser.leaveNested(); }
+	};
+
+	// Top-level subprograms parsed ahead on worker threads. A pre-scan
+	// matching mulai/selesai cuts the token stream into one slice per
+	// subprogram; each is parsed by a fresh parser into a buffer. A slice
+	// is spliced in only where the sequential parse would start it in the
+	// same state and its own parse was clean, so the tree and diagnostics
+	// match sequential parsing; anything else is parsed in place. The scan
+	// stops at PARALLEL_PARSE_MAX_TOKENS, so the lexer's window stays
+	// bounded; once that batch is used up the next one is scanned.
+	struct Slice {
+		vector<Token> tokens;
+		string output;                        // what parsing it printed, replayed on splice
+		bool clean = false;                   // no syntax error, and it ended with the slice
+	};
+	bool scanAhead();                         // slices from cur; false if not worth it
+	bool aheadSpent();                        // batch used up, more subprograms past it
+	void runAhead(const function<void(unsigned worker, size_t slice)> &parse);
+	int takeAhead();                          // slice starting at cur to splice, or -1
+	bool parsedClean() const;                 // for workers: whole slice, no error
+
+	vector<Slice> ahead;
+	size_t nextAhead = 0;
+	unsigned aheadWorkers = 0;
+	bool aheadCapped = false;                 // the scan stopped at the token cap
+	uint32_t aheadFrom = 0;                   // offset the scan started at
+
+	Lexer &lexer;
+	Token cur;                                // lexer.peek(0)
+	bool debug;                               // trace, if compiled in
+	ostream &diag;                            // syntax errors and traces
+	unsigned errors = 0;
+	unsigned maxErrors = DEFAULT_MAX_ERRORS;
+	bool panicking = false;
+	bool stopped = false;                     // error cap reached, input skipped
+	unsigned depth = 0;
+	unsigned maxDepth = DEFAULT_MAX_DEPTH;
+	bool tooDeep = false;                     // nesting budget exceeded, tree dropped
+};
+
+// Recursive-descent parser that builds the concrete parse tree. All parse
+// state lives in the object, so separate files can be parsed concurrently,
+// each with its own Lexer (sourceText is per thread); top-level
+// subprograms of one file are parsed ahead the same way.
+class Parser : public ParserBase {
+public:
+	Parser(Lexer &lexer, Arena &arena, bool debug = false, ostream &diag = cerr);
+
+	ParseNode* parse();                       // whole program, then expect EOF; null if too deep
+
+private:
+	ParseNode* makeNode(RuleKind rule);       // opens a rule node
+	ParseNode* closeNode(ParseNode* node);    // packs its children
+	ParseNode* makeTokenNode(const Token &t);
+	ParseNode* makeMissingNode(TokenKind expected);
+	void addChild(ParseNode* parent, ParseNode* child);
+	ParseNode* matchType(TokenKind expected);
+	ParseNode* matchKeyword(Keyword kw);
+	ParseNode* tryMatchKeyword(Keyword kw);
+	ParseNode* matchEntryEnd();
+	void parseAhead();                        // top-level subprograms, into per-worker arenas
+
+	ParseNode* program();
+	ParseNode* program_header();
+	ParseNode* declaration_part();
+	ParseNode* const_declaration();
+	ParseNode* type_declaration();
+	ParseNode* type_definition();
+	ParseNode* var_declaration();
+	ParseNode* identifier_list();
+	ParseNode* type_spec();
+	ParseNode* array_type();
+	ParseNode* range();
+	ParseNode* subprogram_declaration();
+	ParseNode* procedure_declaration();
+	ParseNode* function_declaration();
+	ParseNode* formal_parameter_list();
+	ParseNode* parameter_group();
+	ParseNode* block();
+	ParseNode* compound_statement();
+	ParseNode* statement_list();
+	ParseNode* statement();
+	ParseNode* assignment_statement();
+	ParseNode* if_statement();
+	ParseNode* while_statement();
+	ParseNode* for_statement();
+	ParseNode* procedure_function_call();
+	ParseNode* parameter_list();
+	ParseNode* expression();
+	ParseNode* simple_expression();
+	ParseNode* term();
+	ParseNode* factor();
+	ParseNode* relational_operator();
+	ParseNode* additive_operator();
+	ParseNode* multiplicative_operator();
+
+	Arena &arena;
+	vector<ParseNode*> pending;               // children of the open rules
+	vector<size_t> marks;                     // where each open rule starts
+	vector<ParseNode*> aheadNodes;            // by slice
+};
+
+ParseNode* buildTree(Lexer &input, Arena &arena, unsigned maxErrors = DEFAULT_MAX_ERRORS,
+                     unsigned maxDepth = DEFAULT_MAX_DEPTH, bool trace = false);
+// tableDriven: parse with TableParser (table_parser.hpp), same tree and output;
+// trace: recursive descent with tracing on (PARSE_TRACE builds only)
+ParseNode* parser_main(Lexer &input, Arena &arena, unsigned maxErrors = DEFAULT_MAX_ERRORS,
+                       unsigned maxDepth = DEFAULT_MAX_DEPTH, bool tableDriven = false,
+                       bool trace = false);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,33 @@
+#ifndef RUNSCAN_HPP
+#define RUNSCAN_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace std;
+
+// Bytes that keep the DFA in the same state (whitespace in the start state,
+// identifier/number characters, comment and string bodies). The lexer skips
+// a whole run at once instead of stepping byte by byte.
+// The set is stored as up to MAX_RANGES byte ranges for the SIMD scanners
+// plus a plain membership table for the scalar tail.
+struct ByteRun {
+    static const int MAX_RANGES = 8;
+
+    uint8_t numRanges = 0;        // 0 = no run for this state
+    uint8_t lo[MAX_RANGES] = {};
+    uint8_t hi[MAX_RANGES] = {};
+    bool hasNewline = false;      // run can cross lines
+    uint8_t member[256] = {};
+
+    // Build from a membership table; '\0' is never part of a run so scans
+    // always stop at the end-of-input sentinel
+    static ByteRun fromSet(const uint8_t set[256]);
+};
+
+// Skip the run starting at s[i] (stops at n at the latest) and return the
+// index of the first byte outside it. line/column are advanced over the
+// skipped bytes using newline counts. Uses AVX2 or SSE2 when available.
+size_t scanRun(const ByteRun &run, const char *s, size_t i, size_t n, int &line, int &column);
+
+#endif
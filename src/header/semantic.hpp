@@ -2,6 +2,8 @@
 #define SEMANTIC_HPP
 
 #include "ast.hpp"
+#include "ast_visitor.hpp"
+#include "flat_ast.hpp"
 #include "tab.hpp"
 #include "btab.hpp"
 #include "atab.hpp"
@@ -10,8 +12,12 @@
 
 using namespace std;
 
-// Semantic analyzer class
-class SemanticAnalyzer {
+// Semantic analyzer class. An ASTVisitor pass: statements and expressions
+// are only walked where they belong, and a node is checked once its
+// operands have been.
+class SemanticAnalyzer : public ASTVisitor<SemanticAnalyzer> {
+    friend class ASTVisitor<SemanticAnalyzer>;
+
 private:
     bool hasErrors;
     
@@ -19,26 +25,56 @@ private:
     bool isCompatibleType(const string& type1, const string& type2);
     string getOperatorResultType(const string& op, const string& leftType, const string& rightType);
     
-    // Visit functions
-    void visitProgram(ProgramNode* node);
-    void visitDeclarations(DeclarationsNode* node);
-    void visitBlock(BlockNode* node);
-    void visitVarDecl(VarDeclNode* node);
-    void visitConstDecl(ConstDeclNode* node);
-    void visitTypeDecl(TypeDeclNode* node);
-    void visitProcedureDecl(ProcedureDeclNode* node);
-    void visitFunctionDecl(FunctionDeclNode* node);
-    void visitStatement(ASTNode* node);
-    void visitExpression(ASTNode* node);
-    void visitAssign(AssignNode* node);
-    void visitIf(IfNode* node);
-    void visitWhile(WhileNode* node);
-    void visitFor(ForNode* node);
-    void visitProcedureCall(ProcedureCallNode* node);
-    void visitVar(VarNode* node);
-    void visitArrayAccess(ArrayAccessNode* node);
-    void visitBinOp(BinOpNode* node);
-    void visitUnaryOp(UnaryOpNode* node);
+    // Walk node only if it is a statement / an expression
+    void statement(ASTNode* node);
+    void expression(ASTNode* node);
+    void declareParams(Span<ParamNode*> params, int blockIdx);
+    void subprogramBody(BlockNode* body);
+
+    // Visitor hooks
+    using ASTVisitor<SemanticAnalyzer>::enter;
+    using ASTVisitor<SemanticAnalyzer>::walkChildren;
+    using ASTVisitor<SemanticAnalyzer>::leave;
+
+    bool enter(ProgramNode* node);
+    void walkChildren(ProgramNode* node);
+    bool enter(DeclarationsNode* node);
+    void walkChildren(BlockNode* node);
+    bool enter(VarDeclNode* node);
+    bool enter(ConstDeclNode* node);
+    bool enter(TypeDeclNode* node);
+    bool enter(ProcedureDeclNode* node);
+    void walkChildren(ProcedureDeclNode* node);
+    void leave(ProcedureDeclNode* node);
+    bool enter(FunctionDeclNode* node);
+    void walkChildren(FunctionDeclNode* node);
+    void leave(FunctionDeclNode* node);
+    bool enter(AssignNode* node);
+    void walkChildren(AssignNode* node);
+    void leave(AssignNode* node);
+    void walkChildren(IfNode* node);
+    void leave(IfNode* node);
+    void walkChildren(WhileNode* node);
+    void leave(WhileNode* node);
+    void walkChildren(ForNode* node);
+    void leave(ForNode* node);
+    bool enter(ProcedureCallNode* node);
+    void walkChildren(ProcedureCallNode* node);
+    void leave(ProcedureCallNode* node);
+    bool enter(VarNode* node);
+    void walkChildren(ArrayAccessNode* node);
+    void leave(ArrayAccessNode* node);
+    bool walkLeft(BinOpNode* node);
+    void walkRight(BinOpNode* node);
+    void leave(BinOpNode* node);
+    void walkChildren(UnaryOpNode* node);
+    void leave(UnaryOpNode* node);
+    bool enter(NumberNode* node);
+    bool enter(RealNode* node);
+    bool enter(StringNode* node);
+    bool enter(CharNode* node);
+    bool enter(BoolNode* node);
+    bool literal(ASTNode* node, const char* type);
     
 
     void checkAssignmentTarget(ASTNode* target);
@@ -57,10 +93,14 @@ public:
     bool analyze(ASTNode* root);
     string getObjectName(int objCode);
     string getTypeName(int typeCode);
-    void printDecoratedAST(ASTNode* node, const string& prefix = "", bool isLast = true);
+    void printDecoratedAST(const FlatAST& ast);
 };
 
-void semanticAnalysis(ASTNode* ast);
+bool semanticAnalysis(ASTNode* ast);          // false if the analysis stopped on an error
+
+// Prints what semanticAnalysis printed for an AST decorated by an earlier
+// run, with the tables already filled in (compile cache hit)
+void replaySemanticAnalysis(ASTNode* ast, bool completed);
 void printSymbolTables();
 // void printDecoratedASTTree(ASTNode* root);
 
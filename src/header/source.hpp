@@ -0,0 +1,35 @@
+#ifndef SOURCE_HPP
+#define SOURCE_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+// A source file held once in memory. Regular files are mmap'ed read-only;
+// anything mmap refuses (pipes, special files) is read() into a buffer.
+// Either way at least PADDING zero bytes follow the text, so the lexer can
+// read one past the end without bounds checks.
+class SourceFile {
+public:
+    static const size_t PADDING = 64;
+
+    SourceFile() = default;
+    SourceFile(const SourceFile &) = delete;
+    SourceFile &operator=(const SourceFile &) = delete;
+    ~SourceFile();
+
+    bool open(const string &path);
+    string_view text() const { return string_view(data, size); }
+
+private:
+    const char *data = nullptr;
+    size_t size = 0;
+    void *mapping = nullptr;    // whole reserved region when mmap'ed
+    size_t mappingSize = 0;
+    vector<char> buffer;        // read() fallback
+};
+
+#endif
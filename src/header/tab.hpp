@@ -3,6 +3,7 @@
 
 #include <string>
 #include <vector>
+#include "intern.hpp"
 using namespace std;
 
 enum ObjectClass {
@@ -15,7 +16,7 @@ enum ObjectClass {
 };
 
 struct TabEntry {
-    string name;
+    Symbol name;
     int link;
     int obj;
     int type;
@@ -29,10 +30,11 @@ struct TabEntry {
 extern vector<TabEntry> tab;
 
 void initializeTab();
-bool isDuplicateInCurrentBlock(const string& name);
+bool isDuplicateInCurrentBlock(Symbol name);
 
-int insertIdentifier(const string& name, int obj, int type, int ref, int nrm, int adr);
-int lookupIdentifier(const string& name);
+int insertIdentifier(Symbol name, int obj, int type, int ref, int nrm, int adr);
+int lookupIdentifier(Symbol name);
+bool isBuiltinProcedure(Symbol name);   // writeln, write, readln, read
 
 void openScope();
 void closeScope();
@@ -0,0 +1,39 @@
+#ifndef TABLE_PARSER_HPP
+#define TABLE_PARSER_HPP
+
+#include "parser.hpp"
+
+using namespace std;
+
+// Table-driven LL(1) parser over the tables tools/llgen generates from
+// parser/pascal-s.ebnf (header/grammar_gen.hpp). On a program without
+// syntax errors it builds the same parse tree as Parser, under the same
+// nesting budget. It pulls tokens from the lexer as it goes, like Parser,
+// but neither reports nor recovers: on the first error parse() returns
+// null with the tokens before it consumed. Adding a construct is a
+// grammar change plus its parse node kind.
+class TableParser {
+public:
+	TableParser(Lexer &lexer, Arena &arena, unsigned maxDepth = DEFAULT_MAX_DEPTH)
+		: lexer(lexer), arena(arena), maxDepth(maxDepth) {}
+
+	ParseNode* parse();                       // whole program; null on a syntax error
+
+private:
+	Lexer &lexer;
+	Arena &arena;
+	unsigned maxDepth;
+	vector<int> stack;                        // grammar symbols still to match, and CLOSE marks
+	vector<ParseNode*> open;                  // rule nodes whose children are pending
+	vector<ParseNode*> pending;
+	vector<size_t> marks;
+};
+
+// Parses with TableParser; on a syntax error the lexer restarts and the
+// recursive-descent parser parses the program again to report and
+// recover, so the output is the same as buildTree's either way, at twice
+// the cost for a program with errors.
+ParseNode* buildTableTree(Lexer &input, Arena &arena, unsigned maxErrors = DEFAULT_MAX_ERRORS,
+                          unsigned maxDepth = DEFAULT_MAX_DEPTH);
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef TOKEN_HPP
+#define TOKEN_HPP
+
+#include <cstdint>
+#include <string_view>
+
+using namespace std;
+
+// Token kinds; the names match the token types used in rule.json
+enum TokenKind : uint8_t {
+    TK_NONE = 0,            // not a final state
+    TK_IDENTIFIER,
+    TK_KEYWORD,
+    TK_NUMBER,
+    TK_REAL_NUMBER,
+    TK_CHAR_LITERAL,
+    TK_STRING_LITERAL,
+    TK_BOOLEAN,
+    TK_ARITHMETIC_OPERATOR,
+    TK_RELATIONAL_OPERATOR,
+    TK_LOGICAL_OPERATOR,
+    TK_ASSIGN_OPERATOR,
+    TK_RANGE_OPERATOR,
+    TK_COLON,
+    TK_SEMICOLON,
+    TK_COMMA,
+    TK_DOT,
+    TK_LPARENTHESIS,
+    TK_RPARENTHESIS,
+    TK_LBRACKET,
+    TK_RBRACKET,
+    TK_COMMENT,             // never reaches the parser
+    TK_ERROR,
+    TK_EOF,
+    TK_COUNT
+};
+
+// Sub-ID of a KEYWORD token
+enum Keyword : uint8_t {
+    KW_NONE = 0,
+    KW_PROGRAM, KW_VARIABEL, KW_MULAI, KW_SELESAI,
+    KW_JIKA, KW_MAKA, KW_SELAIN_ITU, KW_SELAMA, KW_LAKUKAN,
+    KW_UNTUK, KW_KE, KW_TURUN_KE,
+    KW_INTEGER, KW_REAL, KW_BOOLEAN, KW_CHAR, KW_LARIK, KW_DARI,
+    KW_PROSEDUR, KW_FUNGSI, KW_KONSTANTA, KW_TIPE,
+    KW_KASUS, KW_REKAMAN, KW_ULANGI, KW_SAMPAI,
+    KW_COUNT
+};
+
+// Sub-ID of an ARITHMETIC/RELATIONAL/LOGICAL_OPERATOR token
+enum Operator : uint8_t {
+    OP_NONE = 0,
+    OP_PLUS, OP_MINUS, OP_STAR, OP_SLASH, OP_BAGI, OP_MOD,
+    OP_EQ, OP_NE, OP_LT, OP_LE, OP_GT, OP_GE,
+    OP_DAN, OP_ATAU, OP_TIDAK,
+    OP_COUNT
+};
+
+const char *tokenKindName(TokenKind kind);
+const char *keywordName(Keyword kw);
+const char *operatorName(Operator op);
+
+// Reverse lookups, TK_NONE / KW_NONE / OP_NONE if unknown
+TokenKind tokenKindFromName(string_view name);
+Keyword keywordFromName(string_view word);
+Operator operatorFromName(string_view text);
+
+#endif
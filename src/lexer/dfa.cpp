@@ -0,0 +1,352 @@
+#include "dfa.hpp"
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <unordered_map>
+#include "json.hpp"
+
+using json = nlohmann::json;
+
+static unordered_map<char, string> buildCharMap(const json &charClasses) {
+    unordered_map<char, string> charMap;
+
+    for (auto &cls : charClasses.items()) {
+        string className = cls.key();
+        string chars = cls.value();
+
+        for (char c : chars) {
+            if (c == '\\' && chars.length() > 1) {
+                size_t pos = chars.find(c);
+                if (pos != string::npos && pos + 1 < chars.length()) {
+                    char escaped = chars[pos + 1];
+                    switch (escaped) {
+                        case 'n': charMap['\n'] = className; break;
+                        case 't': charMap['\t'] = className; break;
+                        case 'r': charMap['\r'] = className; break;
+                        case '\\': charMap['\\'] = className; break;
+                        case '\'': charMap['\''] = className; break;
+                        default: charMap[escaped] = className; break;
+                    }
+                    chars = chars.substr(pos + 2);
+                    continue;
+                }
+            }
+            charMap[c] = className;
+        }
+    }
+
+    charMap['\0'] = "eof";
+    return charMap;
+}
+
+static string classifyChar(char c, const unordered_map<char, string> &charMap) {
+    auto it = charMap.find(c);
+    if (it != charMap.end()) {
+        return it->second;
+    }
+    return "any";
+}
+
+static DFATable buildDFATable(const json &rules) {
+    DFATable dfa;
+    auto charMap = buildCharMap(rules["character_classes"]);
+
+    // Assign integer IDs: start state first, then in order of appearance
+    unordered_map<string, int> stateId;
+    auto idOf = [&](const string &name) {
+        auto it = stateId.find(name);
+        if (it != stateId.end()) return it->second;
+        int id = (int)dfa.stateNames.size();
+        stateId[name] = id;
+        dfa.stateNames.push_back(name);
+        return id;
+    };
+
+    string start = rules["dfa_config"]["start_state"];
+    dfa.startState = idOf(start);
+
+    unordered_map<string, unordered_map<string,string>> transition;
+    for (auto &block : rules["transitions"]) {
+        for (auto &r : block["rules"]) {
+            string from = r["from"], inp = r["input"], to = r["to"];
+            idOf(from);
+            idOf(to);
+            transition[from][inp] = to;
+        }
+    }
+    for (auto &s : rules["dfa_config"]["final_states"]) idOf(s);
+
+    dfa.numStates = (int)dfa.stateNames.size();
+    dfa.next.assign((size_t)dfa.numStates * 256, DFATable::NO_STATE);
+    dfa.isFinal.assign(dfa.numStates, 0);
+    dfa.tokenKind.assign(dfa.numStates, TK_NONE);
+
+    for (auto &s : rules["dfa_config"]["final_states"]) dfa.isFinal[stateId[s]] = 1;
+
+    unordered_map<string,string> stateToToken =
+        rules["state_token_map"].get<unordered_map<string,string>>();
+    for (auto &st : stateToToken) {
+        auto it = stateId.find(st.first);
+        if (it != stateId.end()) dfa.tokenKind[it->second] = tokenKindFromName(st.second);
+    }
+
+    if (stateId.count("q_identifier")) dfa.identifierState = stateId["q_identifier"];
+    if (stateId.count("q_error")) dfa.errorState = stateId["q_error"];
+
+    // Resolve exact char > character class > 'any' once per (state, byte)
+    for (auto &row : transition) {
+        int from = stateId[row.first];
+        const auto &out = row.second;
+        for (int b = 0; b < 256; ++b) {
+            char c = (char)b;
+            auto it = out.find(string(1, c));
+            if (it == out.end()) it = out.find(classifyChar(c, charMap));
+            if (it == out.end() && c != '\0') it = out.find("any");
+            if (it != out.end()) dfa.next[(size_t)from * 256 + b] = (int16_t)stateId[it->second];
+        }
+    }
+
+    for (int b = 0; b < 256; ++b) {
+        string cls = classifyChar((char)b, charMap);
+        dfa.skipInStart[b] = (cls == "space" || cls == "tab" || cls == "newline");
+    }
+
+    return dfa;
+}
+
+DFATable minimizeDFA(const DFATable &dfa, DFAStats *stats) {
+    const int n = dfa.numStates;
+
+    // Drop states that cannot be reached from the start state
+    vector<int> order;
+    vector<uint8_t> reachable(n, 0);
+    reachable[dfa.startState] = 1;
+    order.push_back(dfa.startState);
+    for (size_t k = 0; k < order.size(); ++k) {
+        for (int b = 0; b < 256; ++b) {
+            int t = dfa.step(order[k], (unsigned char)b);
+            if (t != DFATable::NO_STATE && !reachable[t]) {
+                reachable[t] = 1;
+                order.push_back(t);
+            }
+        }
+    }
+    sort(order.begin(), order.end());
+
+    // Local numbering over reachable states; index m is the implicit "no transition" sink
+    const int m = (int)order.size();
+    vector<int> local(n, -1);
+    for (int i = 0; i < m; ++i) local[order[i]] = i;
+    auto target = [&](int i, int b) {
+        int t = dfa.step(order[i], (unsigned char)b);
+        return t == DFATable::NO_STATE ? m : local[t];
+    };
+
+    // Initial partition: states must agree on everything the lexer looks at besides
+    // the table itself. Start, identifier and error states and the sink stay alone.
+    vector<int> block(m + 1);
+    vector<vector<int>> members;
+    {
+        unordered_map<string, int> keyToBlock;
+        for (int i = 0; i <= m; ++i) {
+            string key;
+            if (i == m) key = "#sink";
+            else {
+                int s = order[i];
+                if (s == dfa.startState || s == dfa.identifierState || s == dfa.errorState)
+                    key = "#" + to_string(s);
+                else
+                    key = to_string(dfa.isFinal[s]) + ":" + to_string(dfa.tokenKind[s]);
+            }
+            auto it = keyToBlock.find(key);
+            if (it == keyToBlock.end()) {
+                it = keyToBlock.emplace(key, (int)members.size()).first;
+                members.emplace_back();
+            }
+            block[i] = it->second;
+            members[it->second].push_back(i);
+        }
+    }
+
+    // Inverse transitions: pred[b][t] = states that move to t on byte b
+    vector<vector<vector<int>>> pred(256, vector<vector<int>>(m + 1));
+    for (int i = 0; i < m; ++i)
+        for (int b = 0; b < 256; ++b) pred[b][target(i, b)].push_back(i);
+
+    // Hopcroft refinement, using whole blocks as splitters for every byte
+    vector<int> work;
+    vector<uint8_t> inWork;
+    for (int k = 0; k < (int)members.size(); ++k) {
+        work.push_back(k);
+        inWork.push_back(1);
+    }
+
+    vector<int> hits(members.size(), 0);
+    vector<uint8_t> marked(m + 1, 0);
+    while (!work.empty()) {
+        int splitter = work.back();
+        work.pop_back();
+        inWork[splitter] = 0;
+        vector<int> splitterStates = members[splitter];
+
+        for (int b = 0; b < 256; ++b) {
+            vector<int> touched;
+            for (int t : splitterStates) {
+                for (int s : pred[b][t]) {
+                    if (marked[s]) continue;
+                    marked[s] = 1;
+                    if (hits[block[s]]++ == 0) touched.push_back(block[s]);
+                }
+            }
+            for (int y : touched) {
+                if (hits[y] < (int)members[y].size()) {
+                    vector<int> in, out;
+                    for (int s : members[y]) (marked[s] ? in : out).push_back(s);
+                    int z = (int)members.size();
+                    members[y] = in;
+                    members.push_back(out);
+                    hits.push_back(0);
+                    for (int s : out) block[s] = z;
+                    if (inWork[y]) {
+                        work.push_back(z);
+                        inWork.push_back(1);
+                    } else {
+                        int smaller = members[y].size() <= members[z].size() ? y : z;
+                        inWork.push_back(0);
+                        work.push_back(smaller);
+                        inWork[smaller] = 1;
+                    }
+                }
+                hits[y] = 0;
+            }
+            for (int t : splitterStates)
+                for (int s : pred[b][t]) marked[s] = 0;
+        }
+    }
+
+    // Renumber blocks: start block first, then by lowest original state
+    vector<int> newId(members.size(), -1);
+    DFATable out;
+    auto assign = [&](int i) {
+        int y = block[i];
+        if (newId[y] == -1) {
+            newId[y] = out.numStates++;
+            out.stateNames.push_back("");
+        }
+        string &name = out.stateNames[newId[y]];
+        name += (name.empty() ? "" : "|") + dfa.stateNames[order[i]];
+    };
+    assign(local[dfa.startState]);
+    for (int i = 0; i < m; ++i) if (order[i] != dfa.startState) assign(i);
+
+    out.next.assign((size_t)out.numStates * 256, DFATable::NO_STATE);
+    out.isFinal.assign(out.numStates, 0);
+    out.tokenKind.assign(out.numStates, TK_NONE);
+    for (int i = 0; i < m; ++i) {
+        int s = newId[block[i]];
+        out.isFinal[s] = dfa.isFinal[order[i]];
+        out.tokenKind[s] = dfa.tokenKind[order[i]];
+        for (int b = 0; b < 256; ++b) {
+            int t = target(i, b);
+            if (t != m) out.next[(size_t)s * 256 + b] = (int16_t)newId[block[t]];
+        }
+    }
+
+    auto mapState = [&](int s) {
+        return (s == DFATable::NO_STATE || local[s] < 0) ? DFATable::NO_STATE : newId[block[local[s]]];
+    };
+    out.startState = mapState(dfa.startState);
+    out.identifierState = mapState(dfa.identifierState);
+    out.errorState = mapState(dfa.errorState);
+    copy(dfa.skipInStart, dfa.skipInStart + 256, out.skipInStart);
+
+    if (stats) {
+        stats->statesBefore = n;
+        stats->statesReachable = m;
+        stats->statesAfter = out.numStates;
+    }
+    return out;
+}
+
+void computeRuns(DFATable &dfa) {
+    dfa.runs.assign(dfa.numStates, ByteRun());
+    for (int s = 0; s < dfa.numStates; ++s) {
+        uint8_t set[256] = {};
+        for (int b = 0; b < 256; ++b)
+            set[b] = s == dfa.startState ? dfa.skipInStart[b] : dfa.step(s, (unsigned char)b) == s;
+        dfa.runs[s] = ByteRun::fromSet(set);
+    }
+}
+
+KeywordTable buildKeywordTable(const vector<pair<string, WordClass>> &words) {
+    vector<pair<string, WordClass>> unique;
+    unordered_set<string> seen;
+    for (auto &w : words)
+        if (seen.insert(w.first).second) unique.push_back(w);
+
+    KeywordTable table;
+    uint32_t size = 1;
+    while (size < unique.size()) size <<= 1;
+
+    // Search for a seed without collisions, doubling the table if none is found
+    for (;; size <<= 1) {
+        for (uint32_t seed = 0; seed < 100000; ++seed) {
+            vector<int> owner(size, -1);
+            bool ok = true;
+            for (size_t i = 0; i < unique.size() && ok; ++i) {
+                uint32_t slot = keywordHash(unique[i].first.data(), unique[i].first.size(), seed) & (size - 1);
+                if (owner[slot] != -1) ok = false;
+                else owner[slot] = (int)i;
+            }
+            if (!ok) continue;
+
+            table.seed = seed;
+            table.mask = size - 1;
+            table.words.assign(size, "");
+            table.classes.assign(size, WORD_IDENTIFIER);
+            table.subs.assign(size, 0);
+            for (uint32_t slot = 0; slot < size; ++slot) {
+                if (owner[slot] == -1) continue;
+                const string &w = unique[owner[slot]].first;
+                WordClass wc = unique[owner[slot]].second;
+                table.words[slot] = w;
+                table.classes[slot] = wc;
+                if (wc == WORD_KEYWORD) table.subs[slot] = keywordFromName(w);
+                else if (wc == WORD_BOOLEAN) table.subs[slot] = (w == "benar");
+                else table.subs[slot] = operatorFromName(w);
+            }
+            return table;
+        }
+    }
+}
+
+bool loadRulesFile(const string &path, LexerRules &out, DFAStats *stats) {
+    ifstream jfile(path);
+    if (!jfile) {
+        cerr << "Error: cannot open " << path << "\n";
+        return false;
+    }
+    json rules;
+    jfile >> rules;
+
+    // Token types are a fixed enum on the compiler side
+    for (auto &st : rules["state_token_map"].items()) {
+        string type = st.value();
+        if (tokenKindFromName(type) == TK_NONE) {
+            cerr << "Error: unknown token type '" << type << "' in " << path << "\n";
+            return false;
+        }
+    }
+
+    out.dfa = minimizeDFA(buildDFATable(rules), stats);
+    computeRuns(out.dfa);
+
+    // Keyword/operator words, in lookup priority order
+    vector<pair<string, WordClass>> words;
+    for (auto &kw : rules["keyword_lookup"]["boolean_literals"]) words.push_back({kw, WORD_BOOLEAN});
+    for (auto &kw : rules["keyword_lookup"]["logical_operators"]) words.push_back({kw, WORD_LOGICAL_OPERATOR});
+    for (auto &kw : rules["keyword_lookup"]["arithmetic_word_operators"]) words.push_back({kw, WORD_ARITHMETIC_OPERATOR});
+    for (auto &kw : rules["keyword_lookup"]["keywords"]) words.push_back({kw, WORD_KEYWORD});
+    out.words = buildKeywordTable(words);
+    return true;
+}
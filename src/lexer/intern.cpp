@@ -0,0 +1,90 @@
+#include "intern.hpp"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Open-addressing table of ids; spellings are copied into fixed blocks that
+// never move, so the string_views handed out stay valid.
+class Interner {
+public:
+    Interner() : slots(1024, 0) {
+        names.push_back(string_view());
+        hashes.push_back(0);
+    }
+
+    Symbol intern(string_view s) {
+        if (s.empty()) return Symbol();
+        uint32_t h = hash(s);
+        lock_guard<mutex> guard(lock);
+
+        size_t mask = slots.size() - 1;
+        for (size_t i = h & mask;; i = (i + 1) & mask) {
+            uint32_t id = slots[i];
+            if (id == 0) break;
+            if (hashes[id] == h && names[id] == s) return Symbol(id);
+        }
+
+        uint32_t id = (uint32_t)names.size();
+        names.push_back(store(s));
+        hashes.push_back(h);
+        if (names.size() * 2 > slots.size()) grow();
+        else place(id);
+        return Symbol(id);
+    }
+
+    string_view str(Symbol s) {
+        lock_guard<mutex> guard(lock);
+        return s.id < names.size() ? names[s.id] : string_view();
+    }
+
+private:
+    static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+    static uint32_t hash(string_view s) {
+        uint32_t h = 2166136261u;
+        for (unsigned char c : s) h = (h ^ c) * 16777619u;
+        return h;
+    }
+
+    string_view store(string_view s) {
+        if (used + s.size() > BLOCK_SIZE) {
+            blocks.emplace_back(new char[max(BLOCK_SIZE, s.size())]);
+            used = 0;
+        }
+        char *dst = blocks.back().get() + used;
+        memcpy(dst, s.data(), s.size());
+        used += s.size();
+        return string_view(dst, s.size());
+    }
+
+    void place(uint32_t id) {
+        size_t mask = slots.size() - 1;
+        size_t i = hashes[id] & mask;
+        while (slots[i]) i = (i + 1) & mask;
+        slots[i] = id;
+    }
+
+    void grow() {
+        slots.assign(slots.size() * 2, 0);
+        for (uint32_t id = 1; id < names.size(); ++id) place(id);
+    }
+
+    mutex lock;
+    vector<string_view> names;      // by id
+    vector<uint32_t> hashes;        // by id
+    vector<uint32_t> slots;         // 0 = empty, size is a power of two
+    vector<unique_ptr<char[]>> blocks;
+    size_t used = BLOCK_SIZE;
+};
+
+// Built on first use so other globals can intern during static init
+static Interner &interner() {
+    static Interner table;
+    return table;
+}
+
+Symbol intern(string_view spelling) { return interner().intern(spelling); }
+
+string_view Symbol::str() const { return interner().str(*this); }
@@ -1,229 +1,253 @@
 #include "lexer.hpp"
+#include "source.hpp"
+#include <algorithm>
+#include <thread>
 
-unordered_map<char, string> buildCharMap(const json &charClasses) {
-    unordered_map<char, string> charMap;
-    
-    for (auto &cls : charClasses.items()) {
-        string className = cls.key();
-        string chars = cls.value();
-        
-        for (char c : chars) {
-            if (c == '\\' && chars.length() > 1) {
-                size_t pos = chars.find(c);
-                if (pos != string::npos && pos + 1 < chars.length()) {
-                    char escaped = chars[pos + 1];
-                    switch (escaped) {
-                        case 'n': charMap['\n'] = className; break;
-                        case 't': charMap['\t'] = className; break;
-                        case 'r': charMap['\r'] = className; break;
-                        case '\\': charMap['\\'] = className; break;
-                        case '\'': charMap['\''] = className; break;
-                        default: charMap[escaped] = className; break;
-                    }
-                    chars = chars.substr(pos + 2); 
-                    continue;
-                }
-            }
-            charMap[c] = className;
-        }
+thread_local string_view sourceText;
+
+// Sub-ID of a symbolic operator, words are resolved by the keyword table
+static uint8_t symbolOperator(const char *s, size_t n) {
+    char a = s[0], b = n > 1 ? s[1] : '\0';
+    switch (a) {
+        case '+': return OP_PLUS;
+        case '-': return OP_MINUS;
+        case '*': return OP_STAR;
+        case '/': return OP_SLASH;
+        case '=': return OP_EQ;
+        case '<': return b == '>' ? OP_NE : b == '=' ? OP_LE : OP_LT;
+        case '>': return b == '=' ? OP_GE : OP_GT;
     }
-    
-    charMap['\0'] = "eof";
-    return charMap;
+    return OP_NONE;
 }
 
-string classifyChar(char c, const unordered_map<char, string> &charMap) {
-    auto it = charMap.find(c);
-    if (it != charMap.end()) {
-        return it->second;
+// Token accepted in `state`; identifier-shaped words go through the keyword
+// table (boolean > logical > arithmetic > keyword)
+static Token acceptedToken(const LexerRules &rules, int state, string_view input,
+                           size_t start, size_t end, int line, int column, bool internName) {
+    static const TokenKind wordKinds[] = {
+        TK_IDENTIFIER, TK_KEYWORD, TK_LOGICAL_OPERATOR, TK_ARITHMETIC_OPERATOR, TK_BOOLEAN
+    };
+    Token t{(TokenKind)rules.dfa.tokenKind[state], 0, (uint32_t)start, (uint32_t)(end - start), line, column, Symbol{}};
+    if (state == rules.dfa.identifierState) {
+        WordClass wc = rules.words.classify(input.data() + start, end - start, t.sub);
+        if (wc != WORD_IDENTIFIER) t.kind = wordKinds[wc];
+        else if (internName) t.sym = intern(input.substr(start, end - start));
+    } else if (t.kind == TK_ARITHMETIC_OPERATOR || t.kind == TK_RELATIONAL_OPERATOR) {
+        t.sub = symbolOperator(input.data() + start, end - start);
     }
-    return "any";
+    return t;
 }
 
-vector<Token> runDFA(
-    const string &input,
-    const json &rules,
-    const unordered_set<string> &keywords,
-    const unordered_set<string> &logical_ops,
-    const unordered_set<string> &arith_word_ops,
-    const unordered_set<string> &boolean_literals
-) 
-{
-    // Build character classification map
-    auto charMap = buildCharMap(rules["character_classes"]);
-    
-    // Build transition table
-    unordered_map<string, unordered_map<string,string>> transition;
-    for (auto &block : rules["transitions"]) {
-        for (auto &r : block["rules"]) {
-            string from = r["from"], inp = r["input"], to = r["to"];
-            transition[from][inp] = to;
-        }
-    }
+static Token errorToken(size_t start, size_t end, int line, int column) {
+    return Token{TK_ERROR, 0, (uint32_t)start, (uint32_t)(end - start), line, column, Symbol{}};
+}
 
-    unordered_set<string> finals;
-    for (auto &s : rules["dfa_config"]["final_states"])
-        finals.insert(s);
+static const Token eofToken = Token{TK_EOF, 0, 0, 0, 0, 0, Symbol{}};
 
-    unordered_map<string,string> stateToToken =
-        rules["state_token_map"].get<unordered_map<string,string>>();
+Lexer::Lexer(string_view input, const LexerRules &rules, ostream *diag)
+    : input(input), rules(rules), diag(diag), ring(16) {
+    sourceText = input;
 
-    vector<Token> tokens;
-    string state = rules["dfa_config"]["start_state"];
-    string cur;
+    unsigned cores = thread::hardware_concurrency();
+    if (input.size() >= PARALLEL_LEX_MIN_BYTES && cores >= 2) chunks = cores;
+}
+
+Lexer::Lexer(const Lexer &source, const vector<Token> &tokens)
+    : input(source.input), rules(source.rules), diag(nullptr), ring(16) {
+    sourceText = input;
+    size_t cap = ring.size();
+    while (cap < tokens.size()) cap *= 2;
+    ring.resize(cap);
+    copy(tokens.begin(), tokens.end(), ring.begin());
+    count = upFront = tokens.size();
+    cur.done = true;
+}
+
+void Lexer::report(const Token &t, bool atEnd) {
+    reported = true;
+    if (!diag) return;
+    *diag << "Lexical Error: Invalid token '" << lexeme(t) << "' at line "
+          << t.line << ", column " << t.column << (atEnd ? " (end of input)" : "") << endl;
+}
 
-    // Tracking line and column (1-based)
-    int line = 1;
-    int column = 1;
-    int token_start_line = 1;
-    int token_start_column = 1;
+// Run the DFA from cur.pos until one token is accepted; false at end of input
+bool lexToken(const LexerRules &rules, string_view input, LexCursor &cur, Token &out) {
+    if (cur.done) return false;
 
-    for (size_t i = 0; i <= input.size(); ++i) {
-        char c = (i < input.size()) ? input[i] : '\0';
-        string cls = classifyChar(c, charMap);
+    const DFATable &dfa = rules.dfa;
+    int state = dfa.startState;
+    size_t token_start = cur.pos;
+    int token_start_line = cur.line;
+    int token_start_column = cur.column;
 
-        if (state == "q0" && (cls == "space" || cls == "tab" || cls == "newline")) {
+    const char *src = input.data();
+    for (size_t i = cur.pos; i <= input.size(); ++i) {
+        // Skip bytes that would leave the state unchanged in one go
+        const ByteRun &run = dfa.runs[state];
+        if (run.numRanges) i = scanRun(run, src, i, input.size(), cur.line, cur.column);
+
+        char c = src[i];   // '\0' sentinel at input.size()
+        unsigned char uc = (unsigned char)c;
+
+        if (state == dfa.startState && dfa.skipInStart[uc]) {
             // consume whitespace: update line/column
-            if (c == '\n') { line++; column = 1; }
-            else { column++; }
+            if (c == '\n') { cur.line++; cur.column = 1; }
+            else { cur.column++; }
             continue;
         }
 
-        string next;
-        bool transition_found = false;
+        int next = dfa.step(state, uc);
 
-        // Try exact character match first
-        if (transition[state].count(string(1, c))) {
-            next = transition[state][string(1, c)];
-            transition_found = true;
-        }
-        // Try character class match
-        else if (transition[state].count(cls)) {
-            next = transition[state][cls];
-            transition_found = true;
-        }
-        // Try 'any' transition
-        else if (transition[state].count("any") && c != '\0') {
-            next = transition[state]["any"];
-            transition_found = true;
-        }
-
-        if (transition_found) {
-            if (cur.empty()) {
-                token_start_line = line;
-                token_start_column = column;
+        if (next != DFATable::NO_STATE) {
+            if (state == dfa.startState) {
+                token_start = i;
+                token_start_line = cur.line;
+                token_start_column = cur.column;
             }
-            cur += c;
             state = next;
 
             // update line/column after consuming the character
-            if (c == '\n') { line++; column = 1; }
-            else { column++; }
+            if (c == '\n') { cur.line++; cur.column = 1; }
+            else { cur.column++; }
         } else {
             // No valid transition -> check if we ended a token
-            if (finals.count(state)) {
-                string tokType = stateToToken[state];
-                if (state == "q_identifier") {
-                    if(boolean_literals.count(cur)){
-                        tokType = "BOOLEAN";
-                    }
-                    else if (logical_ops.count(cur)) {
-                        tokType = "LOGICAL_OPERATOR";
-                    } else if (arith_word_ops.count(cur)) {
-                        tokType = "ARITHMETIC_OPERATOR";
-                    } else if (keywords.count(cur)) {
-                        tokType = "KEYWORD";
-                    }
+            if (dfa.isFinal[state]) {
+                out = acceptedToken(rules, state, input, token_start, i, token_start_line, token_start_column, cur.internNames);
+                if (out.kind == TK_COMMENT) {
+                    state = dfa.startState;
+                    --i;
+                    continue;
                 }
-                
-                if (tokType == "ERROR" || state == "q_error") {
-                    tokens.push_back({tokType, cur, token_start_line, token_start_column});
-                    cerr << "Lexical Error: Invalid token '" << cur << "' at line "
-                         << token_start_line << ", column " << token_start_column << endl;
-                    return tokens;
+                if (out.kind == TK_ERROR || state == dfa.errorState) {
+                    cur.error = true;
+                    cur.done = true;
                 }
-                
-                tokens.push_back({tokType, cur, token_start_line, token_start_column});
-                cur.clear();
-                state = rules["dfa_config"]["start_state"];
-                --i; // reprocess current character in start state (we did not consume it)
-            } else if (!cur.empty()) {
-                cerr << "Lexical Error: Invalid token '" << cur << "' at line "
-                     << token_start_line << ", column " << token_start_column << endl;
-                tokens.push_back({"ERROR", cur, token_start_line, token_start_column});
-                return tokens;
+                cur.pos = i; // reprocess current character in start state (we did not consume it)
+                return true;
+            } else if (state != dfa.startState) {
+                out = errorToken(token_start, i, token_start_line, token_start_column);
+                cur.error = true;
+                cur.done = true;
+                return true;
             }
         }
     }
 
-    if (!cur.empty()) {
-        if (finals.count(state)) {
-            string tokType = stateToToken[state];
-            if (state == "q_identifier") {
-                if (boolean_literals.count(cur)) {
-                    tokType = "BOOLEAN";
-                }
-                else if (logical_ops.count(cur)) {
-                    tokType = "LOGICAL_OPERATOR";
-                } else if (arith_word_ops.count(cur)) {
-                    tokType = "ARITHMETIC_OPERATOR";
-                } else if (keywords.count(cur)) {
-                    tokType = "KEYWORD";
-                }
-            }
-            if (tokType == "ERROR" || state == "q_error") {
-                tokens.push_back({tokType, cur, token_start_line, token_start_column});
-                cerr << "Lexical Error: Invalid token '" << cur << "' at line "
-                     << token_start_line << ", column " << token_start_column << " (end of input)" << endl;
-                return tokens;
-            }
-            tokens.push_back({tokType, cur, token_start_line, token_start_column});
-        } else {
-            cerr << "Lexical Error: Invalid token '" << cur << "' at line "
-                 << token_start_line << ", column " << token_start_column << " (end of input)" << endl;
-            tokens.push_back({"ERROR", cur, token_start_line, token_start_column});
-        }
+    cur.done = true;
+    cur.pos = input.size();
+    if (state == dfa.startState) return false;
+
+    if (dfa.isFinal[state]) {
+        out = acceptedToken(rules, state, input, token_start, input.size(), token_start_line, token_start_column, cur.internNames);
+        if (out.kind == TK_COMMENT) return false;
+        if (out.kind == TK_ERROR || state == dfa.errorState) cur.error = cur.errorAtEnd = true;
+    } else {
+        out = errorToken(token_start, input.size(), token_start_line, token_start_column);
+        cur.error = cur.errorAtEnd = true;
+    }
+    return true;
+}
+
+bool Lexer::lexOne(Token &out) {
+    if (!lexToken(rules, input, cur, out)) return false;
+    if (cur.error && !reported) unreported = true;
+    return true;
+}
+
+bool Lexer::lexBatch() {
+    size_t rest = input.size() - cur.pos;
+    unsigned n = min<size_t>(chunks, rest / PARALLEL_LEX_MIN_CHUNK);
+    if (n < 2 || cur.done) return false;
+
+    vector<Token> batch = lexParallel(input, rules, n, cur, cur.pos + n * PARALLEL_LEX_MIN_CHUNK);
+    for (const Token &t : batch) slot(count++) = t;
+    if (cur.error && !reported) unreported = true;
+    return true;
+}
+
+Token &Lexer::slot(size_t k) {
+    if (k >= ring.size()) {
+        // Lookahead outgrew the ring: unwrap into a buffer twice the size
+        vector<Token> bigger(ring.size() * 2);
+        for (size_t j = 0; j < count; ++j) bigger[j] = ring[(head + j) & (ring.size() - 1)];
+        ring.swap(bigger);
+        head = 0;
+    }
+    return ring[(head + k) & (ring.size() - 1)];
+}
+
+Token Lexer::peek(size_t k) {
+    Token t = scan(k);
+    // The error token is the last one buffered; report it once it is in view
+    if (unreported && k + 1 >= count) {
+        unreported = false;
+        report(ring[(head + count - 1) & (ring.size() - 1)], cur.errorAtEnd);
+    }
+    return t;
+}
+
+Token Lexer::scan(size_t k) {
+    while (count <= k) {
+        if (chunks && lexBatch()) continue;
+        if (!lexOne(slot(count))) return eofToken;
+        count++;
     }
+    return ring[(head + k) & (ring.size() - 1)];
+}
 
+Token Lexer::next() {
+    Token t = peek(0);
+    if (count > 0) {
+        head = (head + 1) & (ring.size() - 1);
+        count--;
+    }
+    return t;
+}
+
+// Tokens replayed from a slice never leave the ring (nothing is lexed after
+// them), so they are still there from index 0. Otherwise lex again.
+void Lexer::restart() {
+    head = 0;
+    count = upFront;
+    if (upFront) return;
+    cur = LexCursor();
+    unreported = false;
+}
+
+vector<Token> runDFA(string_view input, const LexerRules &rules, ostream *diag) {
+    Lexer lex(input, rules, diag);
+    vector<Token> tokens;
+    for (Token t = lex.next(); t.kind != TK_EOF; t = lex.next()) tokens.push_back(t);
     return tokens;
 }
 
 int lexer_main(int argc, char* argv[]) {
-    if (argc < 2) {
-        cerr << "Usage: " << argv[0] << " <source_file.pas>\n";
-        return 1;
+    string sourceFile, ruleFile;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--rules" && i + 1 < argc) ruleFile = argv[++i];
+        else sourceFile = arg;
     }
-
-    const string ruleFile = "test/milestone-1/rule.json";
-    ifstream jfile(ruleFile);
-    if (!jfile) {
-        cerr << "Error: cannot open " << ruleFile << "\n";
+    if (sourceFile.empty()) {
+        cerr << "Usage: " << argv[0] << " <source_file.pas> [--rules rule.json]\n";
         return 1;
     }
-    json rules;
-    jfile >> rules;
-
-    // Load keyword/operator sets
-    unordered_set<string> keywords;
-    unordered_set<string> logical_ops;
-    unordered_set<string> arith_word_ops;
-    unordered_set<string> boolean_literals;
-    for (auto &kw : rules["keyword_lookup"]["keywords"]) keywords.insert(kw);
-    for (auto &kw : rules["keyword_lookup"]["logical_operators"]) logical_ops.insert(kw);
-    for (auto &kw : rules["keyword_lookup"]["arithmetic_word_operators"]) arith_word_ops.insert(kw);
-    for (auto &kw : rules["keyword_lookup"]["boolean_literals"]) boolean_literals.insert(kw);
-
-    // Read Pascal 
-    ifstream f(argv[1]);
-    if (!f) { cerr << "Cannot open file\n"; return 1; }
-    stringstream buf; buf << f.rdbuf(); string input = buf.str();
+
+    // Tables are compiled in; --rules reloads them from JSON for DFA development
+    LexerRules rules;
+    if (ruleFile.empty()) rules = builtinRules();
+    else if (!loadRulesFile(ruleFile, rules)) return 1;
+
+    // Map Pascal source
+    SourceFile source;
+    if (!source.open(sourceFile)) { cerr << "Cannot open file\n"; return 1; }
 
     // Run DFA
-    vector<Token> toks = runDFA(input, rules, keywords, logical_ops, arith_word_ops, boolean_literals);
+    vector<Token> toks = runDFA(source.text(), rules);
 
     bool hasError = false;
     for (auto &t : toks) {
-        if (t.type == "ERROR") {
+        if (t.kind == TK_ERROR) {
             hasError = true;
             break;
         }
@@ -231,7 +255,7 @@ int lexer_main(int argc, char* argv[]) {
 
     if (!hasError) {
         for (auto &t : toks) {
-            std::cerr << "<" << t.type << "(" << t.lexeme << ")>\n";
+            std::cerr << "<" << typeName(t) << "(" << lexeme(t) << ")>\n";
         }
         return 0;
     }
@@ -0,0 +1,99 @@
+#include "lexer.hpp"
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+// Tokens lexed speculatively from the start of a chunk, as if a token
+// boundary fell exactly there. Line numbers are relative to the chunk and
+// identifiers are interned only once the tokens are adopted.
+struct ChunkResult {
+    vector<Token> tokens;
+    vector<size_t> resume;      // resume[t] = position token t was lexed from
+    vector<int> resumeColumn;   // ... and the cursor column there
+    LexCursor end;              // where the chunk stopped, at or past the next split
+    size_t newlines = 0;        // '\n' bytes inside [split, next split)
+};
+
+static void lexChunk(const LexerRules &rules, string_view input, size_t from, size_t to, ChunkResult &out) {
+    LexCursor cur;
+    cur.pos = from;
+    cur.internNames = false;
+    Token t;
+    for (;;) {
+        size_t start = cur.pos;
+        int column = cur.column;
+        if (!lexToken(rules, input, cur, t)) break;
+        out.resume.push_back(start);
+        out.resumeColumn.push_back(column);
+        out.tokens.push_back(t);
+        if (cur.done || cur.pos >= to) break;
+    }
+    out.end = cur;
+    out.newlines = count(input.begin() + from, input.begin() + to, '\n');
+}
+
+vector<Token> lexParallel(string_view input, const LexerRules &rules, unsigned chunks, LexCursor &cur, size_t to) {
+    const size_t from = cur.pos;
+    const int firstLine = cur.line;
+
+    // Split right after a newline so every chunk starts at column 1
+    vector<size_t> split = {from};
+    for (unsigned k = 1; k < chunks; ++k) {
+        size_t p = max(split.back(), from + (size_t)((double)(to - from) * k / chunks));
+        const void *nl = p < to ? memchr(input.data() + p, '\n', to - p) : nullptr;
+        if (!nl) break;
+        size_t s = (const char *)nl - input.data() + 1;
+        if (s < to) split.push_back(s);
+    }
+    const size_t numChunks = split.size();
+    split.push_back(to);
+
+    vector<ChunkResult> spec(numChunks);
+    vector<thread> workers;
+    for (size_t j = 1; j < numChunks; ++j)
+        workers.emplace_back(lexChunk, cref(rules), input, split[j], split[j + 1], ref(spec[j]));
+
+    // Meanwhile lex the first chunk for real
+    vector<Token> tokens;
+    Token t;
+    while (!cur.done && cur.pos < split[1]) {
+        if (!lexToken(rules, input, cur, t)) break;
+        tokens.push_back(t);
+    }
+    spec[0].newlines = count(input.begin() + from, input.begin() + split[1], '\n');
+    for (auto &w : workers) w.join();
+
+    // Stitch: once the real lexer stops at a position where a chunk also
+    // resumed, everything that chunk lexed from there on is exact up to a
+    // line offset. Otherwise keep lexing for real until the next chunk.
+    // Bytes skipped in the start state do not advance the column, so the
+    // columns have to agree too (they do again after the next newline).
+    size_t j = 1;
+    int delta = firstLine - 1 + (int)spec[0].newlines;    // lines before chunk j
+    for (;;) {
+        while (j < numChunks && cur.pos >= split[j]) {
+            ChunkResult &chunk = spec[j];
+            auto it = lower_bound(chunk.resume.begin(), chunk.resume.end(), cur.pos);
+            size_t at = it - chunk.resume.begin();
+            if (it != chunk.resume.end() && *it == cur.pos && chunk.resumeColumn[at] == cur.column) {
+                for (size_t k = at; k < chunk.tokens.size(); ++k) {
+                    Token tok = chunk.tokens[k];
+                    tok.line += delta;
+                    if (tok.kind == TK_IDENTIFIER) tok.sym = intern(input.substr(tok.offset, tok.length));
+                    tokens.push_back(tok);
+                }
+                cur = chunk.end;
+                cur.line += delta;
+                cur.internNames = true;
+            } else if (it != chunk.resume.end()) {
+                break;                          // not in sync yet
+            }
+            delta += (int)chunk.newlines;
+            j++;
+        }
+        if (cur.done || (j == numChunks && cur.pos >= to)) break;
+        if (!lexToken(rules, input, cur, t)) break;
+        tokens.push_back(t);
+    }
+    return tokens;
+}
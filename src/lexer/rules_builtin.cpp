@@ -0,0 +1,30 @@
+#include "dfa.hpp"
+#include "rules_gen.hpp"
+
+LexerRules builtinRules() {
+    using namespace rules_gen;
+
+    LexerRules rules;
+    DFATable &dfa = rules.dfa;
+
+    dfa.numStates = NUM_STATES;
+    dfa.startState = START_STATE;
+    dfa.identifierState = IDENTIFIER_STATE;
+    dfa.errorState = ERROR_STATE;
+    dfa.next.resize((size_t)NUM_STATES * 256);
+    for (int st = 0; st < NUM_STATES; ++st)
+        for (int b = 0; b < 256; ++b) dfa.next[st * 256 + b] = NEXT[st * NUM_CLASSES + BYTE_CLASS[b]];
+    dfa.isFinal.assign(IS_FINAL, IS_FINAL + NUM_STATES);
+    dfa.stateNames.assign(STATE_NAMES, STATE_NAMES + NUM_STATES);
+    dfa.tokenKind.assign(TOKEN_KIND, TOKEN_KIND + NUM_STATES);
+    for (int b = 0; b < 256; ++b) dfa.skipInStart[b] = SKIP_IN_START[b];
+    computeRuns(dfa);
+
+    rules.words.seed = KEYWORD_SEED;
+    rules.words.mask = KEYWORD_SLOTS - 1;
+    rules.words.words.assign(KEYWORD_WORDS, KEYWORD_WORDS + KEYWORD_SLOTS);
+    rules.words.classes.assign(KEYWORD_CLASS, KEYWORD_CLASS + KEYWORD_SLOTS);
+    rules.words.subs.assign(KEYWORD_SUB, KEYWORD_SUB + KEYWORD_SLOTS);
+
+    return rules;
+}
@@ -0,0 +1,130 @@
+#include "runscan.hpp"
+
+#if defined(__x86_64__) || defined(__SSE2__)
+#include <immintrin.h>
+#define RUNSCAN_X86 1
+#endif
+
+ByteRun ByteRun::fromSet(const uint8_t set[256]) {
+    ByteRun run;
+    int ranges = 0;
+    for (int b = 1; b < 256; ++b) {
+        if (!set[b]) continue;
+        run.member[b] = 1;
+        if (b > 1 && set[b - 1]) {
+            run.hi[ranges - 1] = (uint8_t)b;
+            continue;
+        }
+        if (ranges == MAX_RANGES) return ByteRun();   // too fragmented, step byte by byte
+        run.lo[ranges] = run.hi[ranges] = (uint8_t)b;
+        ranges++;
+    }
+    run.numRanges = (uint8_t)ranges;
+    run.hasNewline = set[(unsigned char)'\n'];
+    return run;
+}
+
+typedef size_t (*ScanFn)(const ByteRun &, const unsigned char *, size_t, size_t, int &, size_t &);
+
+static size_t scanScalar(const ByteRun &run, const unsigned char *s, size_t i, size_t n,
+                         int &lines, size_t &lastNewline) {
+    while (i < n && run.member[s[i]]) {
+        if (s[i] == '\n') { lines++; lastNewline = i; }
+        i++;
+    }
+    return i;
+}
+
+#ifdef RUNSCAN_X86
+
+// A byte is in range r when (byte - lo[r]) <= (hi[r] - lo[r]) unsigned,
+// tested with min_epu8; the stop position is the first zero bit of the mask.
+static size_t scanSSE2(const ByteRun &run, const unsigned char *s, size_t i, size_t n,
+                       int &lines, size_t &lastNewline) {
+    __m128i lo[ByteRun::MAX_RANGES], width[ByteRun::MAX_RANGES];
+    for (int r = 0; r < run.numRanges; ++r) {
+        lo[r] = _mm_set1_epi8((char)run.lo[r]);
+        width[r] = _mm_set1_epi8((char)(run.hi[r] - run.lo[r]));
+    }
+    const __m128i nl = _mm_set1_epi8('\n');
+
+    while (i + 16 <= n) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i in = _mm_setzero_si128();
+        for (int r = 0; r < run.numRanges; ++r) {
+            __m128i d = _mm_sub_epi8(x, lo[r]);
+            in = _mm_or_si128(in, _mm_cmpeq_epi8(_mm_min_epu8(d, width[r]), d));
+        }
+        unsigned stop = ~(unsigned)_mm_movemask_epi8(in) & 0xFFFFu;
+        unsigned taken = stop ? (1u << __builtin_ctz(stop)) - 1 : 0xFFFFu;
+        if (run.hasNewline) {
+            unsigned nls = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(x, nl)) & taken;
+            if (nls) {
+                lines += __builtin_popcount(nls);
+                lastNewline = i + 31 - __builtin_clz(nls);
+            }
+        }
+        if (stop) return i + __builtin_ctz(stop);
+        i += 16;
+    }
+    return scanScalar(run, s, i, n, lines, lastNewline);
+}
+
+__attribute__((target("avx2")))
+static size_t scanAVX2(const ByteRun &run, const unsigned char *s, size_t i, size_t n,
+                       int &lines, size_t &lastNewline) {
+    __m256i lo[ByteRun::MAX_RANGES], width[ByteRun::MAX_RANGES];
+    for (int r = 0; r < run.numRanges; ++r) {
+        lo[r] = _mm256_set1_epi8((char)run.lo[r]);
+        width[r] = _mm256_set1_epi8((char)(run.hi[r] - run.lo[r]));
+    }
+    const __m256i nl = _mm256_set1_epi8('\n');
+
+    while (i + 32 <= n) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(s + i));
+        __m256i in = _mm256_setzero_si256();
+        for (int r = 0; r < run.numRanges; ++r) {
+            __m256i d = _mm256_sub_epi8(x, lo[r]);
+            in = _mm256_or_si256(in, _mm256_cmpeq_epi8(_mm256_min_epu8(d, width[r]), d));
+        }
+        unsigned stop = ~(unsigned)_mm256_movemask_epi8(in);
+        unsigned taken = stop ? (1u << __builtin_ctz(stop)) - 1 : 0xFFFFFFFFu;
+        if (run.hasNewline) {
+            unsigned nls = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, nl)) & taken;
+            if (nls) {
+                lines += __builtin_popcount(nls);
+                lastNewline = i + 31 - __builtin_clz(nls);
+            }
+        }
+        if (stop) return i + __builtin_ctz(stop);
+        i += 32;
+    }
+    return scanSSE2(run, s, i, n, lines, lastNewline);
+}
+
+static ScanFn pickScan() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return scanAVX2;
+    return scanSSE2;
+}
+
+#else
+
+static ScanFn pickScan() { return scanScalar; }
+
+#endif
+
+static const ScanFn scanImpl = pickScan();
+
+size_t scanRun(const ByteRun &run, const char *s, size_t i, size_t n, int &line, int &column) {
+    int lines = 0;
+    size_t lastNewline = 0;
+    size_t end = scanImpl(run, (const unsigned char *)s, i, n, lines, lastNewline);
+    if (lines) {
+        line += lines;
+        column = (int)(end - lastNewline);
+    } else {
+        column += (int)(end - i);
+    }
+    return end;
+}
@@ -0,0 +1,54 @@
+#include "source.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+SourceFile::~SourceFile() {
+    if (mapping) munmap(mapping, mappingSize);
+}
+
+bool SourceFile::open(const string &path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+        size_t page = (size_t)sysconf(_SC_PAGESIZE);
+        size_t fileSize = (size_t)st.st_size;
+        size_t filePages = (fileSize + page - 1) / page * page;
+        size_t total = (fileSize + PADDING + page - 1) / page * page;
+
+        // Reserve zeroed pages for file + padding, then map the file over the front.
+        // The tail of the last file page is zero-filled by the kernel.
+        void *region = mmap(nullptr, total, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (region != MAP_FAILED) {
+            bool ok = fileSize == 0 ||
+                      mmap(region, filePages, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) != MAP_FAILED;
+            if (ok) {
+                ::close(fd);
+                mapping = region;
+                mappingSize = total;
+                data = (const char *)region;
+                size = fileSize;
+                return true;
+            }
+            munmap(region, total);
+        }
+    }
+
+    // Fallback: read everything, keeping the zero padding
+    buffer.assign(PADDING, '\0');
+    size_t len = 0;
+    for (;;) {
+        if (buffer.size() - len < PADDING + 4096) buffer.resize(buffer.size() * 2 + 4096, '\0');
+        ssize_t n = ::read(fd, buffer.data() + len, buffer.size() - len - PADDING);
+        if (n < 0) { ::close(fd); return false; }
+        if (n == 0) break;
+        len += (size_t)n;
+    }
+    ::close(fd);
+    data = buffer.data();
+    size = len;
+    return true;
+}
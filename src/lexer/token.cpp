@@ -0,0 +1,46 @@
+#include "token.hpp"
+
+static const char *const kindNames[TK_COUNT] = {
+    "", "IDENTIFIER", "KEYWORD", "NUMBER", "REAL_NUMBER", "CHAR_LITERAL", "STRING_LITERAL",
+    "BOOLEAN", "ARITHMETIC_OPERATOR", "RELATIONAL_OPERATOR", "LOGICAL_OPERATOR",
+    "ASSIGN_OPERATOR", "RANGE_OPERATOR", "COLON", "SEMICOLON", "COMMA", "DOT",
+    "LPARENTHESIS", "RPARENTHESIS", "LBRACKET", "RBRACKET", "COMMENT", "ERROR", "EOF"
+};
+
+static const char *const keywordNames[KW_COUNT] = {
+    "", "program", "variabel", "mulai", "selesai",
+    "jika", "maka", "selain-itu", "selama", "lakukan",
+    "untuk", "ke", "turun-ke",
+    "integer", "real", "boolean", "char", "larik", "dari",
+    "prosedur", "fungsi", "konstanta", "tipe",
+    "kasus", "rekaman", "ulangi", "sampai"
+};
+
+static const char *const operatorNames[OP_COUNT] = {
+    "", "+", "-", "*", "/", "bagi", "mod",
+    "=", "<>", "<", "<=", ">", ">=",
+    "dan", "atau", "tidak"
+};
+
+const char *tokenKindName(TokenKind kind) { return kind < TK_COUNT ? kindNames[kind] : ""; }
+const char *keywordName(Keyword kw) { return kw < KW_COUNT ? keywordNames[kw] : ""; }
+const char *operatorName(Operator op) { return op < OP_COUNT ? operatorNames[op] : ""; }
+
+// Only used while loading rules, so a linear scan is enough
+TokenKind tokenKindFromName(string_view name) {
+    for (int k = 1; k < TK_COUNT; ++k)
+        if (name == kindNames[k]) return (TokenKind)k;
+    return TK_NONE;
+}
+
+Keyword keywordFromName(string_view word) {
+    for (int k = 1; k < KW_COUNT; ++k)
+        if (word == keywordNames[k]) return (Keyword)k;
+    return KW_NONE;
+}
+
+Operator operatorFromName(string_view text) {
+    for (int k = 1; k < OP_COUNT; ++k)
+        if (text == operatorNames[k]) return (Operator)k;
+    return OP_NONE;
+}
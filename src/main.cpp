@@ -1,67 +1,126 @@
 #include "header/lexer.hpp"
 #include "header/parser.hpp"
 #include "header/ast.hpp"
+#include "header/ast_parser.hpp"
+#include "header/flat_ast.hpp"
 #include "header/semantic.hpp"
+#include "header/source.hpp"
+#include "header/compile_cache.hpp"
 
-int main(int argc, char* argv[]) {
-    if (argc < 2) {
-        cerr << "Usage: " << argv[0] << " <source_file.pas>\n";
-        return 1;
+// Everything printed after semantic analysis, the same on a cache hit
+static void printTables(ASTNode* ast, bool showFlat) {
+    printSymbolTables();
+
+    if (showFlat) {
+        cout << "\n========== Flat AST ==========\n";
+        printFlatAST(flattenAST(ast));
     }
 
-    const string ruleFile = "test/milestone-1/rule.json";
-    ifstream jfile(ruleFile);
-    if (!jfile) {
-        cerr << "Error: cannot open " << ruleFile << "\n";
+    // printDecoratedASTTree(ast);
+}
+
+int main(int argc, char* argv[]) {
+    string sourceFile, ruleFile, cacheDir;
+    bool dumpTokens = false, showParseTree = false, tableDriven = false, trace = false, showFlat = false;
+    unsigned maxErrors = DEFAULT_MAX_ERRORS;
+    unsigned maxDepth = DEFAULT_MAX_DEPTH;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--rules" && i + 1 < argc) ruleFile = argv[++i];
+        else if (arg == "--tokens") dumpTokens = true;
+        else if (arg == "--parse-tree") showParseTree = true;
+        else if (arg == "--ll1") showParseTree = tableDriven = true;   // table-driven parser, builds the parse tree
+        else if (arg == "--trace") showParseTree = trace = true;       // traces the recursive-descent parser
+        else if (arg == "--flat-ast") showFlat = true;
+        else if (arg == "--cache" && i + 1 < argc) cacheDir = argv[++i];
+        else if (arg == "--max-errors" && i + 1 < argc) maxErrors = (unsigned)atoi(argv[++i]);
+        else if (arg == "--max-depth" && i + 1 < argc) maxDepth = (unsigned)atoi(argv[++i]);
+        else sourceFile = arg;
+    }
+    if (sourceFile.empty()) {
+        cerr << "Usage: " << argv[0] << " <source_file.pas> [--tokens] [--parse-tree] [--ll1] [--trace] [--flat-ast] [--cache DIR] [--max-errors N] [--max-depth N] [--rules rule.json]\n";
         return 1;
     }
-    json rules;
-    jfile >> rules;
+    if (trace && !TRACE_ENABLED) cerr << "Parser tracing is compiled out; rebuild with make TRACE=1\n";
 
-    unordered_set<string> keywords;
-    unordered_set<string> logical_ops;
-    unordered_set<string> arith_word_ops;
-    unordered_set<string> boolean_literals;
-    for (auto &kw : rules["keyword_lookup"]["keywords"]) keywords.insert(kw);
-    for (auto &kw : rules["keyword_lookup"]["logical_operators"]) logical_ops.insert(kw);
-    for (auto &kw : rules["keyword_lookup"]["arithmetic_word_operators"]) arith_word_ops.insert(kw);
-    for (auto &kw : rules["keyword_lookup"]["boolean_literals"]) boolean_literals.insert(kw);
+    // Tables are compiled in; --rules reloads them from JSON for DFA development
+    LexerRules rules;
+    if (ruleFile.empty()) rules = builtinRules();
+    else if (!loadRulesFile(ruleFile, rules)) return 1;
 
-    // Read Pascal 
-    ifstream f(argv[1]);
-    if (!f) { cerr << "Cannot open file\n"; return 1; }
-    stringstream buf; buf << f.rdbuf(); string input = buf.str();
+    // Map Pascal source; tokens point into it until the end of main
+    SourceFile source;
+    if (!source.open(sourceFile)) { cerr << "Cannot open file\n"; return 1; }
 
-    // Run DFA
-    cout << "\n========== Generated Token ==========\n";
-    vector<Token> toks = runDFA(input, rules, keywords, logical_ops, arith_word_ops, boolean_literals);
-
-    bool hasError = false;
-    for (auto &t : toks) {
-        if (t.type == "ERROR") {
-            hasError = true;
-            break;
+    // A compile seen before is loaded decorated, skipping lexing, parsing and
+    // semantic analysis. Only the default path is cached: the other modes
+    // print the stages the cache skips.
+    bool useCache = !cacheDir.empty() && !dumpTokens && !showParseTree;
+    uint64_t cacheKey = 0;
+    if (useCache) {
+        cacheKey = compileKey(source.text(), rules, maxErrors, maxDepth);
+        Arena cachedArena;
+        CachedCompile hit;
+        if (loadCompile(cachePath(cacheDir, cacheKey), cacheKey, cachedArena, hit)) {
+            {
+                DiagnosticReplay replay(hit.diagnostics);
+                showAST(hit.ast);
+                replaySemanticAnalysis(hit.ast, hit.completed);
+                printTables(hit.ast, showFlat);
+            }
+            cachedArena.release();
+            return 0;
         }
     }
 
-    if (!hasError) {
+    // The parser pulls tokens from the lexer as it goes. The full token list
+    // is only materialized for --tokens, and lexical errors are then reported
+    // by that pass instead of the streaming one.
+    ostream *lexDiag = &cerr;
+    if (dumpTokens) {
+        cout << "\n========== Generated Token ==========\n";
+        vector<Token> toks = runDFA(source.text(), rules);
+
+        bool hasError = false;
         for (auto &t : toks) {
-            std::cerr << "<" << t.type << "(" << t.lexeme << ")>\n";
+            if (t.kind == TK_ERROR) {
+                hasError = true;
+                break;
+            }
         }
+
+        if (!hasError) {
+            for (auto &t : toks) {
+                std::cerr << "<" << typeName(t) << "(" << lexeme(t) << ")>\n";
+            }
+        }
+        lexDiag = nullptr;
     }
 
-    ParseNode* parseTree = parser_main(toks); 
-    ASTNode* ast = ASTMain(parseTree);
+    DiagnosticCapture capture(useCache);       // stored with the compile
+    Lexer lex(source.text(), rules, lexDiag);
+    Arena astArena;                            // every AST node, freed in one go
+    ASTNode* ast;
+    if (showParseTree) {
+        // Concrete tree first, for printing, then lowered to the AST
+        Arena parseArena;
+        ParseNode* parseTree = parser_main(lex, parseArena, maxErrors, maxDepth, tableDriven, trace);
+        while (lex.next().kind != TK_EOF) {}   // still report lexical errors past where parsing stopped
+        ast = parseTree ? ASTMain(parseTree, astArena) : nullptr;   // null: nested too deep, already reported
+        parseArena.release();                  // the AST does not point into the parse tree
+    } else {
+        ast = parseAST(lex, astArena, maxErrors, maxDepth);   // reads the lexer to the end
+        if (ast) ast = showAST(ast);
+    }
     
     if (ast) {
-        semanticAnalysis(ast);
+        bool completed = semanticAnalysis(ast);
     
-        printSymbolTables();
+        printTables(ast, showFlat);
 
-        // printDecoratedASTTree(ast);
-        
-        delete ast;
+        if (useCache) saveCompile(cachePath(cacheDir, cacheKey), cacheKey, ast, completed, capture.diagnostics());
     }
+    astArena.release();
     
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,34 @@
+#include "arena.hpp"
+#include <cstdint>
+
+void *Arena::allocateSlow(size_t bytes, size_t align) {
+    // Oversized requests get a block of their own; the current block keeps
+    // serving small ones
+    size_t size = bytes + align > BLOCK_SIZE / 4 ? bytes + align : BLOCK_SIZE;
+    char *block = new char[size];
+    blocks.push_back(block);
+    reserved += size;
+
+    size_t at = ((uintptr_t)block + align - 1) / align * align - (uintptr_t)block;
+    if (size != BLOCK_SIZE) return block + at;
+
+    current = block;
+    capacity = size;
+    used = at + bytes;
+    return block + at;
+}
+
+void Arena::release() {
+    for (char *block : blocks) delete[] block;
+    blocks.clear();
+    current = nullptr;
+    used = capacity = reserved = 0;
+}
+
+void Arena::adopt(Arena &other) {
+    blocks.insert(blocks.end(), other.blocks.begin(), other.blocks.end());
+    reserved += other.reserved;
+    other.blocks.clear();
+    other.current = nullptr;
+    other.used = other.capacity = other.reserved = 0;
+}
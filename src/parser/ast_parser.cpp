@@ -0,0 +1,611 @@
+#include "ast_parser.hpp"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// ========== UTILITY ==========
+
+// A missing name reads back as its placeholder label, like in the parse tree
+static Symbol nameOf(const Token &t, bool matched) {
+    return matched ? t.sym : intern("<missing-IDENTIFIER>");
+}
+
+static bool isTypeKeyword(const Token &t) {
+    return isKeyword(t, KW_INTEGER) || isKeyword(t, KW_REAL) ||
+           isKeyword(t, KW_BOOLEAN) || isKeyword(t, KW_CHAR);
+}
+
+// Binary precedence by operator; tidak is prefix only
+static const Precedence binaryPrecedence[OP_COUNT] = {
+    PREC_NONE,
+    PREC_ADDITIVE, PREC_ADDITIVE,                               // + -
+    PREC_MULTIPLICATIVE, PREC_MULTIPLICATIVE,                   // * /
+    PREC_MULTIPLICATIVE, PREC_MULTIPLICATIVE,                   // bagi mod
+    PREC_RELATIONAL, PREC_RELATIONAL, PREC_RELATIONAL,          // = <> <
+    PREC_RELATIONAL, PREC_RELATIONAL, PREC_RELATIONAL,          // <= > >=
+    PREC_MULTIPLICATIVE, PREC_ADDITIVE,                         // dan atau
+    PREC_NONE                                                   // tidak
+};
+
+static int precedenceOf(const Token &t) {
+    if (t.kind != TK_ARITHMETIC_OPERATOR && t.kind != TK_RELATIONAL_OPERATOR &&
+        t.kind != TK_LOGICAL_OPERATOR) return PREC_NONE;
+    int prec = t.sub < OP_COUNT ? binaryPrecedence[t.sub] : PREC_NONE;
+    // A malformed arithmetic token still takes the additive slot and is
+    // reported there, as the grammar's additive-operator rule does
+    if (prec == PREC_NONE && t.kind == TK_ARITHMETIC_OPERATOR) return PREC_ADDITIVE;
+    return prec;
+}
+
+// Top-level constant values; anything else is dropped
+static ASTNode* constValue(Arena &arena, const Token &t) {
+    string val(lexeme(t));
+    switch (t.kind) {
+    case TK_NUMBER:
+        if (val.find('.') != string::npos) return arena.make<RealNode>(stod(val));
+        return arena.make<NumberNode>(stoi(val));
+    case TK_STRING_LITERAL: return arena.make<StringNode>(arena.copyString(val));
+    case TK_CHAR_LITERAL: return arena.make<CharNode>(val.empty() ? '\0' : val[0]);
+    case TK_IDENTIFIER: return arena.make<VarNode>(t.sym);
+    default: return nullptr;
+    }
+}
+
+// Each name of a var-declaration gets its own copy of the array bounds
+static ASTNode* cloneExpr(Arena &arena, const ASTNode* n) {
+    if (!n) return nullptr;
+    switch (n->kind) {
+    case NK_NUMBER: return arena.make<NumberNode>(*static_cast<const NumberNode*>(n));
+    case NK_REAL: return arena.make<RealNode>(*static_cast<const RealNode*>(n));
+    case NK_STRING: return arena.make<StringNode>(*static_cast<const StringNode*>(n));
+    case NK_CHAR: return arena.make<CharNode>(*static_cast<const CharNode*>(n));
+    case NK_BOOLEAN: return arena.make<BoolNode>(*static_cast<const BoolNode*>(n));
+    case NK_VAR: return arena.make<VarNode>(*static_cast<const VarNode*>(n));
+    case NK_ARRAY_ACCESS: {
+        auto *x = static_cast<const ArrayAccessNode*>(n);
+        return arena.make<ArrayAccessNode>(x->arrayName, cloneExpr(arena, x->index));
+    }
+    case NK_BIN_OP: {
+        auto *x = static_cast<const BinOpNode*>(n);
+        return arena.make<BinOpNode>(x->op, cloneExpr(arena, x->left), cloneExpr(arena, x->right));
+    }
+    case NK_UNARY_OP: {
+        auto *x = static_cast<const UnaryOpNode*>(n);
+        return arena.make<UnaryOpNode>(x->op, cloneExpr(arena, x->operand));
+    }
+    case NK_PROCEDURE_CALL: {
+        auto *x = static_cast<const ProcedureCallNode*>(n);
+        auto *call = arena.make<ProcedureCallNode>(x->procName);
+        vector<ASTNode*> args;
+        for (auto arg : x->args) args.push_back(cloneExpr(arena, arg));
+        call->args = arena.copySpan(args);
+        return call;
+    }
+    default: return nullptr;
+    }
+}
+
+static ArrayTypeNode* cloneArrayType(Arena &arena, const ArrayTypeNode* a) {
+    return arena.make<ArrayTypeNode>(cloneExpr(arena, a->rangeStart), cloneExpr(arena, a->rangeEnd), a->elementType);
+}
+
+// ========== DECLARATIONS ==========
+
+// program → program-header + declaration-part + compound-statement + DOT
+ProgramNode* ASTParser::parse() {
+    expectKeyword(KW_PROGRAM);
+    Token name = cur;
+    auto *prog = arena.make<ProgramNode>(nameOf(name, expectType(TK_IDENTIFIER)));
+    expectType(TK_SEMICOLON);
+
+    prog->declarations = arena.make<DeclarationsNode>();
+    vector<ASTNode*> decls;
+    declarations(decls, true);
+    prog->declarations->declarations = arena.copySpan(decls);
+    prog->block = compoundStatement();
+    expectType(TK_DOT);
+
+    expectEnd();
+    return tooDeep ? nullptr : prog;      // the arena still owns it
+}
+
+ASTParser::ASTParser(Lexer &lexer, Arena &arena, bool debug, ostream &diag)
+    : ParserBase(lexer, debug, diag), arena(arena) {}
+
+void ASTParser::parseAhead() {
+    if (!scanAhead()) return;
+    vector<Arena> arenas(aheadWorkers);
+    aheadNodes.assign(ahead.size(), nullptr);
+    runAhead([&](unsigned worker, size_t k) {
+        Lexer replay(lexer, ahead[k].tokens);
+        ostringstream out;
+        ASTParser parser(replay, arenas[worker], false, out);
+        parser.setMaxDepth(maxDepth);
+        aheadNodes[k] = parser.subprogram();
+        ahead[k].clean = parser.parsedClean();
+        ahead[k].output = out.str();
+    });
+    for (auto &a : arenas) arena.adopt(a);
+}
+
+// declaration-part → (const-declaration)* + (type-declaration)* + (var-declaration)* + (subprogram-declaration)*
+void ASTParser::declarations(vector<ASTNode*> &out, bool topLevel) {
+    while (isKeyword(cur, KW_KONSTANTA)) constDeclaration(out, topLevel);
+    while (isKeyword(cur, KW_TIPE)) typeDeclaration(out, topLevel);
+    while (isKeyword(cur, KW_VARIABEL)) varDeclaration(out);
+    do {
+        if (topLevel) parseAhead();
+        while (isKeyword(cur, KW_PROSEDUR) || isKeyword(cur, KW_FUNGSI)) {
+            if (topLevel) {
+                if (aheadSpent()) parseAhead();
+                int k = takeAhead();
+                if (k < 0) {
+                    out.push_back(subprogram());
+                } else {
+                    out.push_back(aheadNodes[k]);
+                }
+                continue;
+            }
+            bool saved = keep;
+            keep = false;
+            subprogram();
+            keep = saved;
+        }
+    } while (recoverDeclarations());
+}
+
+// const-declaration → KEYWORD(konstanta) + (IDENTIFIER := value + SEMICOLON)+
+void ASTParser::constDeclaration(vector<ASTNode*> &out, bool topLevel) {
+    expectKeyword(KW_KONSTANTA);
+
+    // buildAST walks the children four at a time, and a missing value leaves
+    // no child behind, so replay that walk over what was matched
+    vector<Token> items;
+    do {
+        Token t = cur;
+        if (!expectType(TK_IDENTIFIER)) t.kind = TK_NONE;
+        items.push_back(t);
+        t = cur;
+        if (!expectType(TK_ASSIGN_OPERATOR)) t.kind = TK_NONE;
+        items.push_back(t);
+        if (cur.kind == TK_NUMBER || cur.kind == TK_CHAR_LITERAL || cur.kind == TK_REAL_NUMBER ||
+            cur.kind == TK_STRING_LITERAL || cur.kind == TK_BOOLEAN ||
+            cur.kind == TK_IDENTIFIER) {
+            items.push_back(cur);
+            advance();
+        } else {
+            reportAt("Expected constant value but got ");
+        }
+        t = cur;
+        if (!expectEntryEnd()) t.kind = TK_NONE;
+        items.push_back(t);
+    } while (cur.kind == TK_IDENTIFIER);
+
+    // Constants inside a block never reach the AST
+    if (!topLevel) return;
+    for (size_t i = 0; i < items.size(); ) {
+        if (items[i].kind != TK_IDENTIFIER) {
+            i++;
+            continue;
+        }
+        ASTNode* value = i + 2 < items.size() ? constValue(arena, items[i + 2]) : nullptr;
+        if (value) out.push_back(arena.make<ConstDeclNode>(items[i].sym, value));
+        i += 4;
+    }
+}
+
+// type-declaration → KEYWORD(tipe) + (IDENTIFIER := type-definition + SEMICOLON)+
+void ASTParser::typeDeclaration(vector<ASTNode*> &out, bool topLevel) {
+    expectKeyword(KW_TIPE);
+    do {
+        Token name = cur;
+        bool named = expectType(TK_IDENTIFIER);
+        bool assigned = expectType(TK_ASSIGN_OPERATOR);
+
+        // type-definition → type | range
+        TypeSpec def;
+        if (isKeyword(cur, KW_LARIK) || isTypeKeyword(cur)) {
+            def = typeSpec();
+        } else {
+            expression();
+            expectType(TK_RANGE_OPERATOR);
+            expression();
+            def.name = "<range>";
+        }
+        bool closed = expectEntryEnd();
+
+        // Inside a block the whole entry has to be well formed
+        if (named && (topLevel || (assigned && closed))) {
+            auto *decl = arena.make<TypeDeclNode>(name.sym);
+            if (def.array) decl->arrayType = def.array;
+            else decl->definition = intern(def.name);
+            out.push_back(decl);
+        }
+    } while (cur.kind == TK_IDENTIFIER);
+}
+
+// var-declaration → KEYWORD(variabel) + (identifier-list + COLON + type + SEMICOLON)+
+void ASTParser::varDeclaration(vector<ASTNode*> &out) {
+    expectKeyword(KW_VARIABEL);
+    do {
+        vector<Symbol> names = identifierList();
+        expectType(TK_COLON);
+        TypeSpec type = typeSpec();
+        expectEntryEnd();
+
+        Symbol typeName = intern(type.name);
+        for (Symbol name : names) {
+            auto *v = arena.make<VarDeclNode>();
+            v->names = Span<Symbol>{arena.copyArray(&name, 1), 1};
+            if (type.array) v->arrayType = cloneArrayType(arena, type.array);
+            else v->typeName = typeName;
+            out.push_back(v);
+        }
+    } while (cur.kind == TK_IDENTIFIER);
+}
+
+// identifier-list → IDENTIFIER (COMMA + IDENTIFIER)*
+vector<Symbol> ASTParser::identifierList() {
+    vector<Symbol> names;
+    Token t = cur;
+    if (expectType(TK_IDENTIFIER)) names.push_back(t.sym);
+    while (cur.kind == TK_COMMA) {
+        advance();
+        t = cur;
+        if (expectType(TK_IDENTIFIER)) names.push_back(t.sym);
+    }
+    return names;
+}
+
+// type → KEYWORD(integer/real/boolean/char) | array-type
+ASTParser::TypeSpec ASTParser::typeSpec() {
+    TypeSpec type;
+    if (isTypeKeyword(cur)) {
+        type.name = type.head = string(lexeme(cur));
+        advance();
+    } else if (isKeyword(cur, KW_LARIK)) {
+        type = arrayType();
+    } else {
+        reportAt("Unknown type: ");
+    }
+    return type;
+}
+
+// array-type → KEYWORD(larik) + LBRACKET + range + RBRACKET + KEYWORD(dari) + type
+ASTParser::TypeSpec ASTParser::arrayType() {
+    expectKeyword(KW_LARIK);
+    expectType(TK_LBRACKET);
+    ASTNode* lo = expression();
+    expectType(TK_RANGE_OPERATOR);
+    ASTNode* hi = expression();
+    expectType(TK_RBRACKET);
+    expectKeyword(KW_DARI);
+    TypeSpec elem = typeSpec();   // only the element type name is kept
+
+    // The bounds are spelled by their rule labels, as buildAST does
+    TypeSpec type;
+    type.head = "<array-type>";
+    type.name = "larik[<simple-expression> .. <simple-expression>] dari " + elem.name;
+    type.array = arena.make<ArrayTypeNode>(lo, hi, intern(elem.name));
+    return type;
+}
+
+// subprogram-declaration → procedure-declaration | function-declaration
+ASTNode* ASTParser::subprogram() {
+    if (isKeyword(cur, KW_PROSEDUR)) return procedureDeclaration();
+    return functionDeclaration();
+}
+
+// procedure-declaration → KEYWORD(prosedur) + IDENTIFIER + (formal-parameter-list)? + SEMICOLON + block + SEMICOLON
+ProcedureDeclNode* ASTParser::procedureDeclaration() {
+    expectKeyword(KW_PROSEDUR);
+    Token name = cur;
+    auto *proc = arena.make<ProcedureDeclNode>(nameOf(name, expectType(TK_IDENTIFIER)));
+    if (cur.kind == TK_LPARENTHESIS) proc->params = formalParameters();
+    expectType(TK_SEMICOLON);
+    proc->body = block();
+    expectEntryEnd();
+    return proc;
+}
+
+// function-declaration → KEYWORD(fungsi) + IDENTIFIER + (formal-parameter-list)? + COLON + type + SEMICOLON + block + SEMICOLON
+FunctionDeclNode* ASTParser::functionDeclaration() {
+    expectKeyword(KW_FUNGSI);
+    Token name = cur;
+    Symbol sym = nameOf(name, expectType(TK_IDENTIFIER));
+    Span<ParamNode*> params;
+    if (cur.kind == TK_LPARENTHESIS) params = formalParameters();
+    expectType(TK_COLON);
+    TypeSpec ret = typeSpec();
+    expectType(TK_SEMICOLON);
+
+    // buildAST looks for the body one child too far, so it is always null
+    bool saved = keep;
+    keep = false;
+    block();
+    keep = saved;
+    expectEntryEnd();
+
+    auto *func = arena.make<FunctionDeclNode>(sym, intern(ret.head));
+    func->params = params;
+    return func;
+}
+
+// formal-parameter-list → LPARENTHESIS + parameter-group (SEMICOLON + parameter-group)* + RPARENTHESIS
+Span<ParamNode*> ASTParser::formalParameters() {
+    vector<ParamNode*> params;
+    expectType(TK_LPARENTHESIS);
+    for (;;) {
+        // parameter-group → identifier-list + COLON + type
+        auto *param = arena.make<ParamNode>();
+        param->names = arena.copySpan(identifierList());
+        expectType(TK_COLON);
+        TypeSpec type = typeSpec();
+        param->typeName = intern(type.head);
+        params.push_back(param);
+
+        if (cur.kind != TK_SEMICOLON) break;
+        advance();
+    }
+    expectType(TK_RPARENTHESIS);
+    return arena.copySpan(params);
+}
+
+// block → declaration-part? + compound-statement
+BlockNode* ASTParser::block() {
+    Nested level(*this);
+    if (!level.ok) return arena.make<BlockNode>();
+
+    vector<ASTNode*> decls;
+    if (isKeyword(cur, KW_KONSTANTA) ||
+        isKeyword(cur, KW_TIPE) ||
+        isKeyword(cur, KW_VARIABEL)) {
+        declarations(decls, false);
+    }
+    BlockNode* body = compoundStatement();
+    body->declarations = arena.copySpan(decls);
+    return body;
+}
+
+// ========== STATEMENTS ==========
+
+// compound-statement → KEYWORD(mulai) + statement-list + KEYWORD(selesai)
+BlockNode* ASTParser::compoundStatement() {
+    expectKeyword(KW_MULAI);
+    auto *block = arena.make<BlockNode>();
+    vector<ASTNode*> statements;
+
+    // statement-list → statement (SEMICOLON + statement)*
+    for (;;) {
+        if (isStatementStart(cur))
+            if (ASTNode* s = statement()) statements.push_back(s);
+        if (cur.kind == TK_SEMICOLON) {
+            advance();
+            resync();
+        } else if (!recoverStatement()) {
+            break;
+        }
+    }
+
+    expectKeyword(KW_SELESAI);
+    block->statements = arena.copySpan(statements);
+    return block;
+}
+
+// statement → assignment-statement | if-statement | while-statement | for-statement | procedure/function-call
+ASTNode* ASTParser::statement() {
+    Nested level(*this);
+    if (!level.ok) return nullptr;
+
+    if (cur.kind == TK_IDENTIFIER) return assignmentAhead() ? assignment() : call();
+    if (isKeyword(cur, KW_JIKA)) return ifStatement();
+    if (isKeyword(cur, KW_SELAMA)) return whileStatement();
+    if (isKeyword(cur, KW_UNTUK)) return forStatement();
+    return nullptr;
+}
+
+// assignment-statement → IDENTIFIER [subscript]? + ASSIGN_OPERATOR(:=) + expression
+ASTNode* ASTParser::assignment() {
+    Token name = cur;
+    Symbol sym = nameOf(name, expectType(TK_IDENTIFIER));
+
+    ASTNode* target;
+    if (cur.kind == TK_LBRACKET) {
+        advance();
+        ASTNode* index = expression();
+        expectType(TK_RBRACKET);
+        target = arena.make<ArrayAccessNode>(sym, index);
+    } else {
+        target = arena.make<VarNode>(sym);
+    }
+
+    expectType(TK_ASSIGN_OPERATOR);
+    return arena.make<AssignNode>(target, expression());
+}
+
+// if-statement → KEYWORD(jika) + expression + KEYWORD(maka) + statement + (KEYWORD(selain-itu) + statement)?
+ASTNode* ASTParser::ifStatement() {
+    expectKeyword(KW_JIKA);
+    ASTNode* condition = expression();
+    bool hasThen = expectKeyword(KW_MAKA);
+    ASTNode* thenBranch = statement();
+
+    ASTNode* elseBranch = nullptr;
+    if (cur.kind == TK_SEMICOLON && isKeyword(lexer.peek(1), KW_SELAIN_ITU)) {
+        advance();
+        advance();
+        elseBranch = statement();
+    }
+
+    // Without maka buildAST finds neither branch
+    if (!hasThen) thenBranch = elseBranch = nullptr;
+    return arena.make<IfNode>(condition, thenBranch, elseBranch);
+}
+
+// while-statement → KEYWORD(selama) + expression + KEYWORD(lakukan) + compound-statement
+ASTNode* ASTParser::whileStatement() {
+    expectKeyword(KW_SELAMA);
+    ASTNode* condition = expression();
+    bool hasDo = expectKeyword(KW_LAKUKAN);
+    ASTNode* body = compoundStatement();
+
+    if (!hasDo) body = nullptr;
+    return arena.make<WhileNode>(condition, body);
+}
+
+// for-statement → KEYWORD(untuk) + IDENTIFIER + ASSIGN_OPERATOR + expression + (KEYWORD(ke)/KEYWORD(turun-ke)) + expression + KEYWORD(lakukan) + compound-statement
+ASTNode* ASTParser::forStatement() {
+    expectKeyword(KW_UNTUK);
+    Token name = cur;
+    bool named = expectType(TK_IDENTIFIER);
+    bool assigned = expectType(TK_ASSIGN_OPERATOR);
+    ASTNode* start = expression();
+
+    bool ascending = true;
+    if (!acceptKeyword(KW_KE) && acceptKeyword(KW_TURUN_KE)) ascending = false;
+
+    ASTNode* end = expression();
+    bool hasDo = expectKeyword(KW_LAKUKAN);
+    ASTNode* body = compoundStatement();
+
+    // buildAST stops at the first missing piece of the header
+    if (!named || !assigned) {
+        start = end = body = nullptr;
+        ascending = true;
+    } else if (!hasDo) {
+        body = nullptr;
+    }
+    return arena.make<ForNode>(named ? arena.make<VarNode>(name.sym) : nullptr, start, end, body, ascending);
+}
+
+// procedure/function-call → IDENTIFIER + (LPARENTHESIS + parameter-list + RPARENTHESIS)
+ProcedureCallNode* ASTParser::call() {
+    Token name = cur;
+    auto *node = arena.make<ProcedureCallNode>(nameOf(name, expectType(TK_IDENTIFIER)));
+    expectType(TK_LPARENTHESIS);
+    if (cur.kind != TK_RPARENTHESIS) {
+        // parameter-list → expression (COMMA + expression)*
+        vector<ASTNode*> args;
+        if (ASTNode* arg = expression()) args.push_back(arg);
+        while (cur.kind == TK_COMMA) {
+            advance();
+            if (ASTNode* arg = expression()) args.push_back(arg);
+        }
+        node->args = arena.copySpan(args);
+    }
+    expectType(TK_RPARENTHESIS);
+    return node;
+}
+
+// ========== EXPRESSIONS ==========
+
+// Precedence climbing over the grammar's three levels:
+//   expression        → simple-expression (relational-operator + simple-expression)?
+//   simple-expression → (+/-)? term (additive-operator + term)*
+//   term              → factor (multiplicative-operator + factor)*
+// One call per operand instead of one per level; operators are left
+// associative, relational ones do not chain, and a sign only starts a
+// simple-expression and covers its first term.
+ASTNode* ASTParser::expression(int minPrecedence) {
+    ASTNode* left;
+    if (minPrecedence <= PREC_ADDITIVE && (isOperator(cur, OP_PLUS) || isOperator(cur, OP_MINUS))) {
+        Symbol op = intern(lexeme(cur));
+        advance();
+        left = arena.make<UnaryOpNode>(op, expression(PREC_MULTIPLICATIVE));
+    } else {
+        left = factor();
+    }
+
+    for (;;) {
+        int prec = precedenceOf(cur);
+        if (prec == PREC_NONE || prec < minPrecedence) break;
+
+        Symbol op;
+        if (cur.sub < OP_COUNT && binaryPrecedence[cur.sub] == prec) op = intern(lexeme(cur));
+        else reportAt("Expected additive operator but got ");
+        advance();
+
+        left = arena.make<BinOpNode>(op, left, expression(prec + 1));
+        if (prec == PREC_RELATIONAL) break;
+    }
+    return left;
+}
+
+// factor → IDENTIFIER / NUMBER / CHAR_LITERAL / STRING_LITERAL / (LPARENTHESIS + expression + RPARENTHESIS) / LOGICAL_OPERATOR(tidak) + factor / procedure/function-call
+ASTNode* ASTParser::factor() {
+    Nested level(*this);
+    if (!level.ok) return nullptr;
+
+    if (cur.kind == TK_IDENTIFIER) {
+        Token next = lexer.peek(1);
+        if (next.kind == TK_LPARENTHESIS) return call();
+
+        Symbol name = cur.sym;
+        advance();
+        if (next.kind != TK_LBRACKET) return arena.make<VarNode>(name);
+        advance();
+        ASTNode* index = expression();
+        expectType(TK_RBRACKET);
+        return arena.make<ArrayAccessNode>(name, index);
+    }
+
+    if (cur.kind == TK_NUMBER || cur.kind == TK_REAL_NUMBER) {
+        string val(lexeme(cur));
+        advance();
+        if (!keep) return nullptr;
+        if (val.find('.') != string::npos) return arena.make<RealNode>(stod(val));
+        return arena.make<NumberNode>(stoi(val));
+    }
+
+    if (cur.kind == TK_STRING_LITERAL) {
+        string_view val = arena.copyString(lexeme(cur));
+        advance();
+        return arena.make<StringNode>(val);
+    }
+
+    if (cur.kind == TK_CHAR_LITERAL) {
+        string val(lexeme(cur));
+        advance();
+        // Remove single quotes if present
+        if (val.size() >= 3 && val.front() == '\'' && val.back() == '\'') return arena.make<CharNode>(val[1]);
+        return arena.make<CharNode>(val.empty() ? '\0' : val[0]);
+    }
+
+    if (cur.kind == TK_BOOLEAN) {
+        string bl(lexeme(cur));
+        advance();
+        if (bl == "benar") return arena.make<BoolNode>(true);
+        if (bl == "salah") return arena.make<BoolNode>(false);
+        if (keep) diag << "Invalid factor: <factor>\n";
+        return nullptr;
+    }
+
+    if (isOperator(cur, OP_TIDAK)) {
+        advance();
+        return arena.make<UnaryOpNode>(intern("not"), factor());
+    }
+
+    if (cur.kind == TK_LPARENTHESIS) {
+        advance();
+        ASTNode* inner = expression();
+        expectType(TK_RPARENTHESIS);
+        return inner;
+    }
+
+    reportAt("Unexpected token in factor: ");
+    return nullptr;
+}
+
+// ========================
+// BUILD AST
+// ========================
+
+ProgramNode* parseAST(Lexer &input, Arena &arena, unsigned maxErrors, unsigned maxDepth) {
+    ASTParser parser(input, arena);
+    parser.setMaxErrors(maxErrors);
+    parser.setMaxDepth(maxDepth);
+    return parser.parse();
+}
@@ -1,506 +1,772 @@
 #include "parser.hpp"
+#include "table_parser.hpp"
 #include <iostream>
+#include <sstream>
 #include <vector>
 #include <string>
+#include <atomic>
+#include <thread>
 
 using namespace std;
 
-vector<Token> tokens;
-int current = 0;
-bool gDebug = false;
-
 // ========== UTILITY ==========
 
-Token getCurrentToken() {
-    if (current < (int)tokens.size()) return tokens[current];
-    return Token{"EOF", "", 0, 0};
+void ParserBase::advance() {
+    lexer.next();
+    cur = lexer.peek();
+}
+
+// Out of line, so a traced rule only costs the debug test and a call
+void ParserBase::traceRule(const char *event, const char *rule, const char *which) {
+    diag << event << rule << " | " << which << " token: ("
+         << typeName(cur) << ", '" << lexeme(cur) << "' @ " << cur.line << ":" << cur.column << ")\n";
+}
+
+bool ParserBase::expectType(TokenKind expected) {
+    if (cur.kind == expected) {
+        if (tracing()) diag << "Matched type: " << tokenKindName(expected) << " (" << lexeme(cur) << " @ " << cur.line << ":" << cur.column << ")\n";
+        advance();
+        return true;
+    }
+    if (reportable())
+        diag << "Syntax error: expected type '" << tokenKindName(expected) 
+             << "' but got (" << typeName(cur) << ", '" << lexeme(cur) << "' @ " << cur.line << ":" << cur.column << ")\n";
+    return false;
+}
+
+bool ParserBase::expectKeyword(Keyword kw) {
+    if (isKeyword(cur, kw)) {
+        if (tracing()) diag << "Matched token: <KEYWORD, '" << keywordName(kw) << "'>\n";
+        advance();
+        return true;
+    }
+    if (reportable())
+        diag << "Syntax error: expected token (KEYWORD, '" 
+             << keywordName(kw) << "') but got (" << typeName(cur) << ", '" 
+             << lexeme(cur) << "' @ " << cur.line << ":" << cur.column << ")\n";
+    return false;
+}
+
+bool ParserBase::acceptKeyword(Keyword kw) {
+    if (!isKeyword(cur, kw)) return false;
+    advance();
+    return true;
+}
+
+void ParserBase::reportAt(const char *message) {
+    if (!reportable()) return;
+    diag << message << "'" << lexeme(cur) << "' @ " << cur.line << ":" << cur.column << endl;
+}
+
+void ParserBase::expectEnd() {
+    if (cur.kind != TK_EOF && reportable())
+        diag << "Syntax error: unexpected token '" << lexeme(cur) << "' @ " << cur.line << ":" << cur.column << " after program end\n";
+}
+
+bool ParserBase::isStatementStart(const Token &t) {
+    return t.kind == TK_IDENTIFIER || isKeyword(t, KW_JIKA) ||
+           isKeyword(t, KW_SELAMA) || isKeyword(t, KW_UNTUK);
+}
+
+// Tokens an array subscript can contain, and a stray := so that a typo
+// like a[i + := 1] := 2 still reads as an assignment
+static bool inSubscript(TokenKind kind) {
+    switch (kind) {
+    case TK_IDENTIFIER: case TK_NUMBER: case TK_REAL_NUMBER: case TK_CHAR_LITERAL:
+    case TK_STRING_LITERAL: case TK_BOOLEAN: case TK_ARITHMETIC_OPERATOR:
+    case TK_RELATIONAL_OPERATOR: case TK_LOGICAL_OPERATOR: case TK_ASSIGN_OPERATOR: case TK_COMMA:
+    case TK_LPARENTHESIS: case TK_RPARENTHESIS: case TK_LBRACKET: case TK_RBRACKET:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool ParserBase::assignmentAhead() {
+    size_t lookahead = 1;
+
+    // Skip array subscript jika ada: identifier[...]. Subscript yang tidak
+    // ditutup berakhir di token pertama yang tidak mungkin ada di dalamnya,
+    // jadi sisa file tidak ikut dibaca; subscript sepanjang batas dianggap
+    // assignment.
+    if (lexer.scan(lookahead).kind == TK_LBRACKET) {
+        int bracket_count = 0;
+        for (Token t = lexer.scan(lookahead); ; t = lexer.scan(lookahead)) {
+            if (!inSubscript(t.kind)) return false;
+            if (lookahead > SUBSCRIPT_SCAN_MAX_TOKENS) return true;
+            if (t.kind == TK_LBRACKET) bracket_count++;
+            lookahead++;
+            if (t.kind == TK_RBRACKET && --bracket_count == 0) break;
+        }
+    }
+
+    // Sekarang cek token setelah identifier (atau setelah subscript)
+    return lexer.scan(lookahead).kind == TK_ASSIGN_OPERATOR;
+}
+
+// ========== Error Recovery ==========
+
+bool ParserBase::reportable() {
+    if (panicking || stopped) return false;
+    panicking = true;
+    if (maxErrors && errors >= maxErrors) {
+        stopped = true;
+        diag << "Too many syntax errors (" << maxErrors << "), stopping\n";
+        while (!atEnd()) advance();
+        return false;
+    }
+    errors++;
+    return true;
+}
+
+bool ParserBase::enterNested() {
+    if (maxDepth && depth >= maxDepth) {
+        if (!stopped) {
+            stopped = tooDeep = true;
+            diag << "Syntax error: nesting deeper than " << maxDepth << " levels at '" << lexeme(cur)
+                 << "' @ " << cur.line << ":" << cur.column << ", stopping\n";
+            while (!atEnd()) advance();
+        }
+        return false;
+    }
+    depth++;
+    return true;
+}
+
+void ParserBase::reportUnexpected() {
+    if (reportable())
+        diag << "Syntax error: unexpected token '" << lexeme(cur) << "' @ " << cur.line << ":" << cur.column << "\n";
+}
+
+// The lexer stops at an error token and keeps returning it
+bool ParserBase::atEnd() const {
+    return cur.kind == TK_EOF || cur.kind == TK_ERROR;
+}
+
+static bool inSyncSet(const Token &t, unsigned set) {
+    if ((set & SYNC_SEMICOLON) && t.kind == TK_SEMICOLON) return true;
+    if ((set & SYNC_STATEMENT) && (isKeyword(t, KW_JIKA) || isKeyword(t, KW_SELAMA) ||
+                                   isKeyword(t, KW_UNTUK) || isKeyword(t, KW_SELESAI))) return true;
+    if ((set & SYNC_DECLARATION) && (isKeyword(t, KW_KONSTANTA) || isKeyword(t, KW_TIPE) ||
+                                     isKeyword(t, KW_VARIABEL))) return true;
+    if ((set & SYNC_SUBPROGRAM) && (isKeyword(t, KW_PROSEDUR) || isKeyword(t, KW_FUNGSI))) return true;
+    if ((set & SYNC_BODY) && isKeyword(t, KW_MULAI)) return true;
+    return false;
+}
+
+void ParserBase::synchronize(unsigned stop) {
+    while (!atEnd() && !inSyncSet(cur, stop)) advance();
+    if (!atEnd()) resync();
+}
+
+bool ParserBase::recoverStatement() {
+    // The enclosing compound-statement reports a missing selesai
+    if (atEnd() || cur.kind == TK_DOT || isKeyword(cur, KW_SELESAI) || inSyncSet(cur, SYNC_SUBPROGRAM))
+        return false;
+    if (isStatementStart(cur)) {
+        expectType(TK_SEMICOLON);   // two statements without ';' between them
+        resync();
+        return true;
+    }
+    reportUnexpected();
+    synchronize(SYNC_SEMICOLON | SYNC_STATEMENT | SYNC_SUBPROGRAM);
+    return cur.kind == TK_SEMICOLON || isStatementStart(cur);
+}
+
+bool ParserBase::recoverDeclarations() {
+    if (atEnd() || isKeyword(cur, KW_MULAI)) return false;
+    expectKeyword(KW_MULAI);
+    synchronize(SYNC_SUBPROGRAM | SYNC_BODY);
+    return inSyncSet(cur, SYNC_SUBPROGRAM);
+}
+
+bool ParserBase::expectEntryEnd() {
+    if (expectType(TK_SEMICOLON)) {
+        resync();
+        return true;
+    }
+    if (cur.kind == TK_IDENTIFIER) {
+        resync();                   // the next entry starts, only ';' was missing
+    } else {
+        synchronize(SYNC_SEMICOLON | SYNC_DECLARATION | SYNC_SUBPROGRAM | SYNC_BODY);
+        if (cur.kind == TK_SEMICOLON) advance();
+    }
+    return false;
+}
+
+// ========== Parallel Subprograms ==========
+
+bool ParserBase::scanAhead() {
+    ahead.clear();
+    nextAhead = 0;
+    aheadCapped = false;
+    aheadFrom = cur.offset;
+    aheadWorkers = thread::hardware_concurrency();
+    if (tracing() || aheadWorkers < 2) return false;   // keep a trace in order
+
+    for (size_t k = 0; isKeyword(lexer.scan(k), KW_PROSEDUR) || isKeyword(lexer.scan(k), KW_FUNGSI);) {
+        // A subprogram ends with the selesai closing its body, after the
+        // bodies of the subprograms nested in it, and then a ';'
+        size_t end = 0;
+        unsigned open = 0, blocks = 0;
+        for (size_t i = k; !end; ++i) {
+            if (i + 1 >= PARALLEL_PARSE_MAX_TOKENS) {
+                aheadCapped = true;
+                break;
+            }
+            Token t = lexer.scan(i);
+            if (t.kind == TK_EOF || t.kind == TK_ERROR) break;
+            if (isKeyword(t, KW_PROSEDUR) || isKeyword(t, KW_FUNGSI)) {
+                if (!blocks) open++;
+            } else if (isKeyword(t, KW_MULAI)) {
+                blocks++;
+            } else if (isKeyword(t, KW_SELESAI) && blocks && !--blocks && !--open) {
+                if (lexer.scan(i + 1).kind != TK_SEMICOLON) break;
+                end = i + 2;
+            }
+        }
+        if (!end) break;
+
+        Slice slice;
+        for (size_t i = k; i < end; ++i) slice.tokens.push_back(lexer.scan(i));
+        ahead.push_back(move(slice));
+        k = end;
+    }
+
+    // A capped batch holds enough tokens to be worth it with any two slices
+    if (ahead.size() < (aheadCapped ? 2 : PARALLEL_PARSE_MIN_SUBPROGRAMS)) {
+        ahead.clear();
+        return false;
+    }
+    aheadWorkers = min<size_t>(aheadWorkers, ahead.size());
+    return true;
 }
 
-Token cur_tok = getCurrentToken();
+// The calling thread is worker 0
+void ParserBase::runAhead(const function<void(unsigned worker, size_t slice)> &parse) {
+    atomic<size_t> next(0);
+    auto work = [&](unsigned worker) {
+        for (size_t k; (k = next++) < ahead.size();) parse(worker, k);
+    };
+    vector<thread> threads;
+    for (unsigned w = 1; w < aheadWorkers; ++w) threads.emplace_back(work, w);
+    work(0);
+    for (auto &t : threads) t.join();
+}
+
+bool ParserBase::aheadSpent() {
+    // Slices a sequential parse already went past
+    while (nextAhead < ahead.size() && ahead[nextAhead].tokens[0].offset < cur.offset) nextAhead++;
+    return aheadCapped && nextAhead == ahead.size() && cur.offset != aheadFrom;
+}
+
+int ParserBase::takeAhead() {
+    aheadSpent();
+    if (nextAhead == ahead.size() || panicking || stopped) return -1;
 
-void advance() {
-    if (current < tokens.size()) current++;
-    cur_tok = getCurrentToken();
+    Slice &slice = ahead[nextAhead];
+    if (!slice.clean || slice.tokens[0].offset != cur.offset) return -1;
+    diag << slice.output;
+    for (size_t i = 0; i < slice.tokens.size(); ++i) advance();
+    return (int)nextAhead++;
 }
 
-void debugEnter(const string &rule) {
-    if (!gDebug) return;
-    cerr << ">>> Entering rule: " << rule << " | Current token: (" 
-         << cur_tok.type << ", '" << cur_tok.lexeme << "' @ " << cur_tok.line << ":" << cur_tok.column << ")\n";
+bool ParserBase::parsedClean() const {
+    return errors == 0 && !stopped && cur.kind == TK_EOF;
 }
 
-void debugExit(const string &rule) {
-    if (!gDebug) return;
-    cerr << "<<< Exiting rule: " << rule << " | Next token: (" 
-         << cur_tok.type << ", '" << cur_tok.lexeme << "' @ " << cur_tok.line << ":" << cur_tok.column << ")\n";
+void Parser::parseAhead() {
+    if (!scanAhead()) return;
+    vector<Arena> arenas(aheadWorkers);
+    aheadNodes.assign(ahead.size(), nullptr);
+    runAhead([&](unsigned worker, size_t k) {
+        Lexer replay(lexer, ahead[k].tokens);
+        ostringstream out;
+        Parser parser(replay, arenas[worker], false, out);
+        parser.setMaxDepth(maxDepth);
+        aheadNodes[k] = parser.subprogram_declaration();
+        ahead[k].clean = parser.parsedClean();
+        ahead[k].output = out.str();
+    });
+    for (auto &a : arenas) arena.adopt(a);
 }
 
+Parser::Parser(Lexer &lexer, Arena &arena, bool debug, ostream &diag)
+    : ParserBase(lexer, debug, diag), arena(arena) {}
+
 // ========== Parse Tree ==========
-ParseNode* makeNode(const string &label) {
-    auto *n = new ParseNode{label, {}};
-    return n;
+// Children are collected on `pending` while a rule runs and packed into
+// the arena when it returns; rules nest, so each one owns the top of the
+// stack from its mark upwards.
+static const char *const ruleNames[RK_COUNT] = {
+    "", "",
+    "<program>", "<program-header>", "<declaration-part>",
+    "<const-declaration>", "<type-declaration>", "<type-definition>",
+    "<var-declaration>", "<identifier-list>", "<type>", "<array-type>", "<range>",
+    "<subprogram-declaration>", "<procedure-declaration>", "<function-declaration>",
+    "<formal-parameter-list>", "<parameter-group>", "<block>",
+    "<compound-statement>", "<statement-list>", "<statement>",
+    "<assignment-statement>", "<if-statement>", "<while-statement>", "<for-statement>",
+    "<procedure/function-call>", "<parameter-list>",
+    "<expression>", "<simple-expression>", "<term>", "<factor>",
+    "<relational-operator>", "<additive-operator>", "<multiplicative-operator>"
+};
+
+const char *ruleName(RuleKind kind) { return kind < RK_COUNT ? ruleNames[kind] : ""; }
+
+ParseNode* Parser::makeNode(RuleKind rule) {
+    marks.push_back(pending.size());
+    return arena.make<ParseNode>(ParseNode{rule, Token{TK_NONE, 0, 0, 0, 0, 0, Symbol{}}, {}});
 }
 
-ParseNode* makeTokenNode(const Token &t) {
-    auto *n = new ParseNode{t.type + "(" + t.lexeme + ")", {}};
-    return n;
+ParseNode* Parser::closeNode(ParseNode* node) {
+    size_t mark = marks.back();
+    marks.pop_back();
+    size_t n = pending.size() - mark;
+    node->children = Span<ParseNode*>{arena.copyArray(pending.data() + mark, n), n};
+    pending.resize(mark);
+    return node;
 }
 
-void addChild(ParseNode* parent, ParseNode* child) {
-    if (parent && child) parent->children.push_back(child);
+ParseNode* Parser::makeTokenNode(const Token &t) {
+    return arena.make<ParseNode>(ParseNode{RK_TOKEN, t, {}});
+}
+
+ParseNode* Parser::makeMissingNode(TokenKind expected) {
+    return arena.make<ParseNode>(ParseNode{RK_MISSING, Token{expected, 0, 0, 0, 0, 0, Symbol{}}, {}});
+}
+
+string nodeLabel(const ParseNode* node) {
+    if (node->rule == RK_MISSING) return string("<missing-") + tokenKindName(node->tok.kind) + ">";
+    if (!node->isToken()) return ruleName(node->rule);
+    string s = typeName(node->tok);
+    s += '(';
+    s += lexeme(node->tok);
+    s += ')';
+    return s;
+}
+
+void Parser::addChild(ParseNode* parent, ParseNode* child) {
+    if (parent && child) pending.push_back(child);
 }
 
 void printTree(ParseNode* node, const string &prefix, bool isLast) {
     if (!node) return;
 
-    static bool isRootPrinted = false;
-    if (!isRootPrinted) {
-        cout << node->label << "\n";
-        isRootPrinted = true;
-    }
+    if (prefix.empty()) cout << nodeLabel(node) << "\n";   // root
     for (size_t i = 0; i < node->children.size(); ++i) {
         bool last = (i + 1 == node->children.size());
-        cout << prefix << (last ? "└── " : "├── ") << node->children[i]->label << "\n";
+        cout << prefix << (last ? "└── " : "├── ") << nodeLabel(node->children[i]) << "\n";
         string newPrefix = prefix + (last ? "    " : "│   ");
         printTree(node->children[i], newPrefix, last);
     }
-    if (prefix.empty()) {
-        isRootPrinted = false;
-    }
 }
 
 
-ParseNode* matchType(const string &expectedType) {
-    if (cur_tok.type == expectedType) {
-        if (gDebug) cerr << "Matched type: " << expectedType << " (" << cur_tok.lexeme << " @ " << cur_tok.line << ":" << cur_tok.column << ")\n";
-        Token t = cur_tok;
-        advance();
-        return makeTokenNode(t);
-    } else {
-        cerr << "Syntax error: expected type '" << expectedType 
-             << "' but got (" << cur_tok.type << ", '" << cur_tok.lexeme << "' @ " << cur_tok.line << ":" << cur_tok.column << ")\n";
-        return makeNode("<missing-" + expectedType + ">");
-    }
+ParseNode* Parser::matchType(TokenKind expected) {
+    Token t = cur;
+    if (expectType(expected)) return makeTokenNode(t);
+    return makeMissingNode(expected);
 }
 
-ParseNode* matchToken(const Token &expected) {
-    if (cur_tok.type == expected.type && cur_tok.lexeme == expected.lexeme) {
-        if (gDebug) cerr << "Matched token: <" << expected.type << ", '" << expected.lexeme << "'>\n";
-        Token t = cur_tok;
-        advance();
-        return makeTokenNode(t);
-    } else {
-        cerr << "Syntax error: expected token (" << expected.type << ", '" 
-             << expected.lexeme << "') but got (" << cur_tok.type << ", '" 
-             << cur_tok.lexeme << "' @ " << cur_tok.line << ":" << cur_tok.column << ")\n";
-        return makeNode("<missing-" + expected.type + ">");
-    }
+ParseNode* Parser::matchKeyword(Keyword kw) {
+    Token t = cur;
+    if (expectKeyword(kw)) return makeTokenNode(t);
+    return makeMissingNode(TK_KEYWORD);
 }
 
-ParseNode* tryMatchToken(const Token &expected) {
-    if (cur_tok.type == expected.type && cur_tok.lexeme == expected.lexeme) {
-        Token t = cur_tok;
-        advance();
-        return makeTokenNode(t);
-    }
-    return nullptr;
+ParseNode* Parser::tryMatchKeyword(Keyword kw) {
+    Token t = cur;
+    return acceptKeyword(kw) ? makeTokenNode(t) : nullptr;
+}
+
+ParseNode* Parser::matchEntryEnd() {
+    Token t = cur;
+    return expectEntryEnd() ? makeTokenNode(t) : makeMissingNode(TK_SEMICOLON);
 }
 
 // ========== GRAMMAR RULES ==========
 
 // program → program-header + declaration-part + compound-statement + DOT
-ParseNode* program() {
+ParseNode* Parser::program() {
     debugEnter("program");
-    auto *node = makeNode("<program>");
+    auto *node = makeNode(RK_PROGRAM);
     addChild(node, program_header());
     addChild(node, declaration_part());
     addChild(node, compound_statement());
-    addChild(node, matchType("DOT"));
+    addChild(node, matchType(TK_DOT));
     debugExit("program");
-    return node;
+    return closeNode(node);
 }
 
 // program-header → KEYWORD(program) + IDENTIFIER + SEMICOLON
-ParseNode* program_header() {
+ParseNode* Parser::program_header() {
     debugEnter("program_header");
-    auto *node = makeNode("<program-header>");
-    addChild(node, matchToken({"KEYWORD", "program", cur_tok.line, cur_tok.column})); // NOTE
-    addChild(node, matchType("IDENTIFIER"));
-    addChild(node, matchType("SEMICOLON"));
+    auto *node = makeNode(RK_PROGRAM_HEADER);
+    addChild(node, matchKeyword(KW_PROGRAM));
+    addChild(node, matchType(TK_IDENTIFIER));
+    addChild(node, matchType(TK_SEMICOLON));
     debugExit("program_header");
-    return node;
+    return closeNode(node);
 }
 
 // declaration-part → (const-declaration)* + (type-declaration)* + (var-declaration)* + (subprogram-declaration)*
-ParseNode* declaration_part() {
+ParseNode* Parser::declaration_part() {
     debugEnter("declaration_part");
-    auto *node = makeNode("<declaration-part>");
-    while (cur_tok.lexeme == "konstanta") addChild(node, const_declaration());
-    while (cur_tok.lexeme == "tipe") addChild(node, type_declaration());
-    while (cur_tok.lexeme == "variabel") addChild(node, var_declaration());
-    while (cur_tok.lexeme == "prosedur" || cur_tok.lexeme == "fungsi") 
-        addChild(node, subprogram_declaration());
+    auto *node = makeNode(RK_DECLARATION_PART);
+    while (isKeyword(cur, KW_KONSTANTA)) addChild(node, const_declaration());
+    while (isKeyword(cur, KW_TIPE)) addChild(node, type_declaration());
+    while (isKeyword(cur, KW_VARIABEL)) addChild(node, var_declaration());
+    bool topLevel = depth == 0;             // not inside any block
+    do {
+        if (topLevel) parseAhead();
+        while (isKeyword(cur, KW_PROSEDUR) || isKeyword(cur, KW_FUNGSI)) {
+            if (topLevel && aheadSpent()) parseAhead();
+            int k = topLevel ? takeAhead() : -1;
+            addChild(node, k >= 0 ? aheadNodes[k] : subprogram_declaration());
+        }
+    } while (recoverDeclarations());
     debugExit("declaration_part");
-    return node;
+    return closeNode(node);
 }
 
 // const-declaration → KEYWORD(konstanta) + (IDENTIFIER := value + SEMICOLON)+
-ParseNode* const_declaration() {
+ParseNode* Parser::const_declaration() {
     debugEnter("const_declaration");
-    auto *node = makeNode("<const-declaration>");
-    addChild(node, matchToken({"KEYWORD", "konstanta", cur_tok.line, cur_tok.column})); // NOTE
+    auto *node = makeNode(RK_CONST_DECLARATION);
+    addChild(node, matchKeyword(KW_KONSTANTA));
     do {
-        addChild(node, matchType("IDENTIFIER"));
-        addChild(node, matchType("ASSIGN_OPERATOR"));
-        if (cur_tok.type == "NUMBER" || cur_tok.type == "CHAR_LITERAL" || cur_tok.type == "REAL_NUMBER" ||
-            cur_tok.type == "STRING_LITERAL" || cur_tok.type == "BOOLEAN" ||
-            cur_tok.type == "IDENTIFIER") {
-            addChild(node, makeTokenNode(cur_tok));
+        addChild(node, matchType(TK_IDENTIFIER));
+        addChild(node, matchType(TK_ASSIGN_OPERATOR));
+        if (cur.kind == TK_NUMBER || cur.kind == TK_CHAR_LITERAL || cur.kind == TK_REAL_NUMBER ||
+            cur.kind == TK_STRING_LITERAL || cur.kind == TK_BOOLEAN ||
+            cur.kind == TK_IDENTIFIER) {
+            addChild(node, makeTokenNode(cur));
             advance();
         } else {
-            cerr << "Expected constant value but got '" << cur_tok.lexeme << "' @ " << cur_tok.line << ":" << cur_tok.column << endl;
+            reportAt("Expected constant value but got ");
         }
-        addChild(node, matchType("SEMICOLON"));
-    } while (cur_tok.type == "IDENTIFIER");
+        addChild(node, matchEntryEnd());
+    } while (cur.kind == TK_IDENTIFIER);
     debugExit("const_declaration");
-    return node;
+    return closeNode(node);
 }
 
 // type-declaration → KEYWORD(tipe) + (IDENTIFIER := type-definition + SEMICOLON)+
-ParseNode* type_declaration() {
+ParseNode* Parser::type_declaration() {
     debugEnter("type_declaration");
-    auto *node = makeNode("<type-declaration>");
-    addChild(node, matchToken({"KEYWORD", "tipe", cur_tok.line, cur_tok.column})); // NOTE
+    auto *node = makeNode(RK_TYPE_DECLARATION);
+    addChild(node, matchKeyword(KW_TIPE));
     do {
-        addChild(node, matchType("IDENTIFIER"));
-        addChild(node, matchType("ASSIGN_OPERATOR"));
+        addChild(node, matchType(TK_IDENTIFIER));
+        addChild(node, matchType(TK_ASSIGN_OPERATOR));
         addChild(node, type_definition());
-        addChild(node, matchType("SEMICOLON"));
-    } while (cur_tok.type == "IDENTIFIER");
+        addChild(node, matchEntryEnd());
+    } while (cur.kind == TK_IDENTIFIER);
     debugExit("type_declaration");
-    return node;
+    return closeNode(node);
 }
 
 // type-definition → type | range
-ParseNode* type_definition() {
+ParseNode* Parser::type_definition() {
     debugEnter("type_definition");
-    auto *node = makeNode("<type-definition>");
-    if (cur_tok.lexeme == "larik" || cur_tok.lexeme == "integer" ||
-        cur_tok.lexeme == "real" || cur_tok.lexeme == "boolean" || 
-        cur_tok.lexeme == "char") {
+    auto *node = makeNode(RK_TYPE_DEFINITION);
+    if (isKeyword(cur, KW_LARIK) || isKeyword(cur, KW_INTEGER) ||
+        isKeyword(cur, KW_REAL) || isKeyword(cur, KW_BOOLEAN) || 
+        isKeyword(cur, KW_CHAR)) {
         addChild(node, type_spec());
     } else {
         addChild(node, range());
     }
     debugExit("type_definition");
-    return node;
+    return closeNode(node);
 }
 
 // var-declaration → KEYWORD(variabel) + (identifier-list + COLON + type + SEMICOLON)+
-ParseNode* var_declaration() {
+ParseNode* Parser::var_declaration() {
     debugEnter("var_declaration");
-    auto *node = makeNode("<var-declaration>");
-    addChild(node, matchToken({"KEYWORD", "variabel", cur_tok.line, cur_tok.column})); // NOTE
+    auto *node = makeNode(RK_VAR_DECLARATION);
+    addChild(node, matchKeyword(KW_VARIABEL));
     do {
         addChild(node, identifier_list());
-        addChild(node, matchType("COLON"));
+        addChild(node, matchType(TK_COLON));
         addChild(node, type_spec());
-        addChild(node, matchType("SEMICOLON"));
-    } while (cur_tok.type == "IDENTIFIER");
+        addChild(node, matchEntryEnd());
+    } while (cur.kind == TK_IDENTIFIER);
     debugExit("var_declaration");
-    return node;
+    return closeNode(node);
 }
 
 // identifier-list → IDENTIFIER (COMMA + IDENTIFIER)*
-ParseNode* identifier_list() {
+ParseNode* Parser::identifier_list() {
     debugEnter("identifier_list");
-    auto *node = makeNode("<identifier-list>");
-    addChild(node, matchType("IDENTIFIER"));
-    while (cur_tok.type == "COMMA") {
-        addChild(node, makeTokenNode(cur_tok));
+    auto *node = makeNode(RK_IDENTIFIER_LIST);
+    addChild(node, matchType(TK_IDENTIFIER));
+    while (cur.kind == TK_COMMA) {
+        addChild(node, makeTokenNode(cur));
         advance();
-        addChild(node, matchType("IDENTIFIER"));
+        addChild(node, matchType(TK_IDENTIFIER));
     }
     debugExit("identifier_list");
-    return node;
+    return closeNode(node);
 }
 
 // type → KEYWORD(integer/real/boolean/char) | array-type
-ParseNode* type_spec() {
+ParseNode* Parser::type_spec() {
     debugEnter("type_spec");
-    auto *node = makeNode("<type>");
-    if (cur_tok.lexeme == "integer" || cur_tok.lexeme == "real" ||
-        cur_tok.lexeme == "boolean" || cur_tok.lexeme == "char") {
-        addChild(node, makeTokenNode(cur_tok));
+    auto *node = makeNode(RK_TYPE);
+    if (isKeyword(cur, KW_INTEGER) || isKeyword(cur, KW_REAL) ||
+        isKeyword(cur, KW_BOOLEAN) || isKeyword(cur, KW_CHAR)) {
+        addChild(node, makeTokenNode(cur));
         advance();
-    } else if (cur_tok.lexeme == "larik") {
+    } else if (isKeyword(cur, KW_LARIK)) {
         addChild(node, array_type());
     } else {
-        cerr << "Unknown type: '" << cur_tok.lexeme << "' @ " << cur_tok.line << ":" << cur_tok.column << endl;
+        reportAt("Unknown type: ");
     }
     debugExit("type_spec");
-    return node;
+    return closeNode(node);
 }
 
 // array-type → KEYWORD(larik) + LBRACKET + range + RBRACKET + KEYWORD(dari) + type
-ParseNode* array_type() {
+ParseNode* Parser::array_type() {
     debugEnter("array_type");
-    auto *node = makeNode("<array-type>");
-    addChild(node, matchToken({"KEYWORD", "larik", cur_tok.line, cur_tok.column})); // NOTE
-    addChild(node, matchType("LBRACKET"));
+    auto *node = makeNode(RK_ARRAY_TYPE);
+    addChild(node, matchKeyword(KW_LARIK));
+    addChild(node, matchType(TK_LBRACKET));
     addChild(node, range());
-    addChild(node, matchType("RBRACKET"));
-    addChild(node, matchToken({"KEYWORD", "dari", cur_tok.line, cur_tok.column})); // NOTE
+    addChild(node, matchType(TK_RBRACKET));
+    addChild(node, matchKeyword(KW_DARI));
     addChild(node, type_spec());
     debugExit("array_type");
-    return node;
+    return closeNode(node);
 }
 
 // range → expression + RANGE_OPERATOR(..) + expression
-ParseNode* range() {
+ParseNode* Parser::range() {
     debugEnter("range");
-    auto *node = makeNode("<range>");
+    auto *node = makeNode(RK_RANGE);
     addChild(node, expression());
-    addChild(node, matchType("RANGE_OPERATOR"));
+    addChild(node, matchType(TK_RANGE_OPERATOR));
     addChild(node, expression());
     debugExit("range");
-    return node;
+    return closeNode(node);
 }
 
 // subprogram-declaration → procedure-declaration | function-declaration
-ParseNode* subprogram_declaration() {
+ParseNode* Parser::subprogram_declaration() {
     debugEnter("subprogram_declaration");
-    auto *node = makeNode("<subprogram-declaration>");
-    if (cur_tok.lexeme == "prosedur") addChild(node, procedure_declaration());
-    else if (cur_tok.lexeme == "fungsi") addChild(node, function_declaration());
+    auto *node = makeNode(RK_SUBPROGRAM_DECLARATION);
+    if (isKeyword(cur, KW_PROSEDUR)) addChild(node, procedure_declaration());
+    else if (isKeyword(cur, KW_FUNGSI)) addChild(node, function_declaration());
     debugExit("subprogram_declaration");
-    return node;
+    return closeNode(node);
 }
 
 // procedure-declaration → KEYWORD(prosedur) + IDENTIFIER + (formal-parameter-list)? + SEMICOLON + block + SEMICOLON
-ParseNode* procedure_declaration() {
+ParseNode* Parser::procedure_declaration() {
     debugEnter("procedure_declaration");
-    auto *node = makeNode("<procedure-declaration>");
-    addChild(node, matchToken({"KEYWORD", "prosedur", cur_tok.line, cur_tok.column})); // NOTE
-    addChild(node, matchType("IDENTIFIER"));
-    if (cur_tok.type == "LPARENTHESIS") addChild(node, formal_parameter_list());
-    addChild(node, matchType("SEMICOLON"));
+    auto *node = makeNode(RK_PROCEDURE_DECLARATION);
+    addChild(node, matchKeyword(KW_PROSEDUR));
+    addChild(node, matchType(TK_IDENTIFIER));
+    if (cur.kind == TK_LPARENTHESIS) addChild(node, formal_parameter_list());
+    addChild(node, matchType(TK_SEMICOLON));
     addChild(node, block());
-    addChild(node, matchType("SEMICOLON"));
+    addChild(node, matchEntryEnd());
     debugExit("procedure_declaration");
-    return node;
+    return closeNode(node);
 }
 
 // function-declaration → KEYWORD(fungsi) + IDENTIFIER + (formal-parameter-list)? + COLON + type + SEMICOLON + block + SEMICOLON
-ParseNode* function_declaration() {
+ParseNode* Parser::function_declaration() {
     debugEnter("function_declaration");
-    auto *node = makeNode("<function-declaration>");
-    addChild(node, matchToken({"KEYWORD", "fungsi", cur_tok.line, cur_tok.column})); // NOTE
-    addChild(node, matchType("IDENTIFIER"));
-    if (cur_tok.type == "LPARENTHESIS") addChild(node, formal_parameter_list());
-    addChild(node, matchType("COLON"));
+    auto *node = makeNode(RK_FUNCTION_DECLARATION);
+    addChild(node, matchKeyword(KW_FUNGSI));
+    addChild(node, matchType(TK_IDENTIFIER));
+    if (cur.kind == TK_LPARENTHESIS) addChild(node, formal_parameter_list());
+    addChild(node, matchType(TK_COLON));
     addChild(node, type_spec());
-    addChild(node, matchType("SEMICOLON"));
+    addChild(node, matchType(TK_SEMICOLON));
     addChild(node, block());
-    addChild(node, matchType("SEMICOLON"));
+    addChild(node, matchEntryEnd());
     debugExit("function_declaration");
-    return node;
+    return closeNode(node);
 }
 
 // formal-parameter-list → LPARENTHESIS + parameter-group (SEMICOLON + parameter-group)* + RPARENTHESIS
-ParseNode* formal_parameter_list() {
+ParseNode* Parser::formal_parameter_list() {
     debugEnter("formal_parameter_list");
-    auto *node = makeNode("<formal-parameter-list>");
-    addChild(node, matchType("LPARENTHESIS"));
+    auto *node = makeNode(RK_FORMAL_PARAMETER_LIST);
+    addChild(node, matchType(TK_LPARENTHESIS));
     addChild(node, parameter_group());
-    while (cur_tok.type == "SEMICOLON") {
-        addChild(node, makeTokenNode(cur_tok));
+    while (cur.kind == TK_SEMICOLON) {
+        addChild(node, makeTokenNode(cur));
         advance();
         addChild(node, parameter_group());
     }
-    addChild(node, matchType("RPARENTHESIS"));
+    addChild(node, matchType(TK_RPARENTHESIS));
     debugExit("formal_parameter_list");
-    return node;
+    return closeNode(node);
 }
 
 // parameter-group → identifier-list + COLON + type
-ParseNode* parameter_group() {
+ParseNode* Parser::parameter_group() {
     debugEnter("parameter_group");
-    auto *node = makeNode("<parameter-group>");
+    auto *node = makeNode(RK_PARAMETER_GROUP);
     addChild(node, identifier_list());
-    addChild(node, matchType("COLON"));
+    addChild(node, matchType(TK_COLON));
     addChild(node, type_spec());
     debugExit("parameter_group");
-    return node;
+    return closeNode(node);
 }
 
 // block → declaration-part? + compound-statement
-ParseNode* block() {
+ParseNode* Parser::block() {
     debugEnter("block");
-    auto *node = makeNode("<block>");
+    auto *node = makeNode(RK_BLOCK);
+    Nested level(*this);
+    if (!level.ok) { debugExit("block"); return closeNode(node); }
 
-    if (cur_tok.lexeme == "konstanta" ||
-        cur_tok.lexeme == "tipe" ||
-        cur_tok.lexeme == "variabel") {
+    if (isKeyword(cur, KW_KONSTANTA) ||
+        isKeyword(cur, KW_TIPE) ||
+        isKeyword(cur, KW_VARIABEL)) {
         addChild(node, declaration_part());
     }
     
     addChild(node, compound_statement());
 
     debugExit("block");
-    return node;
+    return closeNode(node);
 }
 
 // compound-statement → KEYWORD(mulai) + statement-list + KEYWORD(selesai)
-ParseNode* compound_statement() {
+ParseNode* Parser::compound_statement() {
     debugEnter("compound_statement");
-    auto *node = makeNode("<compound-statement>");
-    addChild(node, matchToken({"KEYWORD", "mulai", cur_tok.line, cur_tok.column})); // NOTE
+    auto *node = makeNode(RK_COMPOUND_STATEMENT);
+    addChild(node, matchKeyword(KW_MULAI));
     addChild(node, statement_list());
-    addChild(node, matchToken({"KEYWORD", "selesai", cur_tok.line, cur_tok.column})); // NOTE
+    addChild(node, matchKeyword(KW_SELESAI));
     debugExit("compound_statement");
-    return node;
-}
-
-bool isStatementStart(const Token &t) {
-    return t.type == "IDENTIFIER" || t.lexeme == "jika" ||
-           t.lexeme == "selama" || t.lexeme == "untuk";
+    return closeNode(node);
 }
 
 // statement-list → statement (SEMICOLON + statement)*
-ParseNode* statement_list() {
+ParseNode* Parser::statement_list() {
     debugEnter("statement_list");
-    auto *node = makeNode("<statement-list>");
+    auto *node = makeNode(RK_STATEMENT_LIST);
 
-    if (isStatementStart(cur_tok))
-        addChild(node, statement());
-    while (cur_tok.type == "SEMICOLON") {
-        addChild(node, makeTokenNode(cur_tok));
-        advance();
-        if (isStatementStart(cur_tok))   // Only add a statement if valid
+    for (;;) {
+        if (isStatementStart(cur))   // Only add a statement if valid
             addChild(node, statement());
+        if (cur.kind == TK_SEMICOLON) {
+            addChild(node, makeTokenNode(cur));
+            advance();
+            resync();
+        } else if (!recoverStatement()) {
+            break;
+        }
     }
     debugExit("statement_list");
-    return node;
+    return closeNode(node);
 }
 
 // statement → assignment-statement | if-statement | while-statement | for-statement | procedure/function-call
-ParseNode* statement() {
+ParseNode* Parser::statement() {
     debugEnter("statement");
-    auto *node = makeNode("<statement>");
-    
-    if (cur_tok.type == "IDENTIFIER") {
-        int lookahead = current + 1;
-        
-        // Skip array subscript jika ada: identifier[...]
-        if (lookahead < tokens.size() && tokens[lookahead].type == "LBRACKET") {
-            // Skip sampai ketemu RBRACKET
-            int bracket_count = 0;
-            while (lookahead < tokens.size()) {
-                if (tokens[lookahead].type == "LBRACKET") bracket_count++;
-                if (tokens[lookahead].type == "RBRACKET") {
-                    bracket_count--;
-                    if (bracket_count == 0) {
-                        lookahead++;
-                        break;
-                    }
-                }
-                lookahead++;
-            }
-        }
-        
-        // Sekarang cek token setelah identifier (atau setelah subscript)
-        if (lookahead < tokens.size() && tokens[lookahead].type == "ASSIGN_OPERATOR") {
+    auto *node = makeNode(RK_STATEMENT);
+    Nested level(*this);
+    if (!level.ok) { debugExit("statement"); return closeNode(node); }
+
+    if (cur.kind == TK_IDENTIFIER) {
+        if (assignmentAhead()) {
             addChild(node, assignment_statement());
         } else {
             addChild(node, procedure_function_call());
         }
     } 
-    else if (cur_tok.lexeme == "jika")
+    else if (isKeyword(cur, KW_JIKA))
         addChild(node, if_statement());
-    else if (cur_tok.lexeme == "selama")
+    else if (isKeyword(cur, KW_SELAMA))
         addChild(node, while_statement());
-    else if (cur_tok.lexeme == "untuk")
+    else if (isKeyword(cur, KW_UNTUK))
         addChild(node, for_statement());
     
     debugExit("statement");
-    return node;
+    return closeNode(node);
 }
 
 // assignment-statement → IDENTIFIER [subscript]? + ASSIGN_OPERATOR(:=) + expression
-ParseNode* assignment_statement() {
+ParseNode* Parser::assignment_statement() {
     debugEnter("assignment_statement");
-    auto *node = makeNode("<assignment-statement>");
+    auto *node = makeNode(RK_ASSIGNMENT_STATEMENT);
     
-    addChild(node, matchType("IDENTIFIER"));
+    addChild(node, matchType(TK_IDENTIFIER));
     
     // Handle array subscript on left-hand side
-    if (cur_tok.type == "LBRACKET") {
-        addChild(node, makeTokenNode(cur_tok));  
+    if (cur.kind == TK_LBRACKET) {
+        addChild(node, makeTokenNode(cur));  
         advance();
         addChild(node, expression());           
-        addChild(node, matchType("RBRACKET"));  
+        addChild(node, matchType(TK_RBRACKET));  
     }
     
-    addChild(node, matchType("ASSIGN_OPERATOR"));
+    addChild(node, matchType(TK_ASSIGN_OPERATOR));
     addChild(node, expression());
     
     debugExit("assignment_statement");
-    return node;
+    return closeNode(node);
 }
 
 // if-statement → KEYWORD(jika) + expression + KEYWORD(maka) + statement + (KEYWORD(selain-itu) + statement)?
-ParseNode* if_statement() {
+ParseNode* Parser::if_statement() {
     debugEnter("if_statement");
-    auto *node = makeNode("<if-statement>");
+    auto *node = makeNode(RK_IF_STATEMENT);
 
     // jika <expr> maka <statement>
-    addChild(node, matchToken({"KEYWORD", "jika", cur_tok.line, cur_tok.column})); // NOTE
+    addChild(node, matchKeyword(KW_JIKA));
     addChild(node, expression());
-    addChild(node, matchToken({"KEYWORD", "maka", cur_tok.line, cur_tok.column})); // NOTE
+    addChild(node, matchKeyword(KW_MAKA));
     addChild(node, statement());
 
     // optionally: selain-itu <statement>
-    if (cur_tok.type == "SEMICOLON" && current + 1 < tokens.size() && 
-        tokens[current + 1].type == "KEYWORD" && 
-        tokens[current + 1].lexeme == "selain-itu") {
-        addChild(node, makeTokenNode(cur_tok));
+    if (cur.kind == TK_SEMICOLON && isKeyword(lexer.peek(1), KW_SELAIN_ITU)) {
+        addChild(node, makeTokenNode(cur));
         advance();
-        addChild(node, makeTokenNode(cur_tok));
+        addChild(node, makeTokenNode(cur));
         advance();
         addChild(node, statement());
     }
 
     debugExit("if_statement");
-    return node;
+    return closeNode(node);
 }
 
 
 // while-statement → KEYWORD(selama) + expression + KEYWORD(lakukan) + compound-statement
-ParseNode* while_statement() {
+ParseNode* Parser::while_statement() {
     debugEnter("while_statement");
-    auto *node = makeNode("<while-statement>");
-    addChild(node, matchToken({"KEYWORD", "selama", cur_tok.line, cur_tok.column})); // NOTE
+    auto *node = makeNode(RK_WHILE_STATEMENT);
+    addChild(node, matchKeyword(KW_SELAMA));
     addChild(node, expression());
-    addChild(node, matchToken({"KEYWORD", "lakukan", cur_tok.line, cur_tok.column})); // NOTE
+    addChild(node, matchKeyword(KW_LAKUKAN));
 
     addChild(node, compound_statement());
     debugExit("while_statement");
-    return node;
+    return closeNode(node);
 }
 
 // for-statement → KEYWORD(untuk) + IDENTIFIER + ASSIGN_OPERATOR + expression + (KEYWORD(ke)/KEYWORD(turun-ke)) + expression + KEYWORD(lakukan) + compound-statement
-ParseNode* for_statement() {
+ParseNode* Parser::for_statement() {
     debugEnter("for_statement");
-    auto *node = makeNode("<for-statement>");
-    addChild(node, matchToken({"KEYWORD", "untuk", cur_tok.line, cur_tok.column})); // NOTE
-    addChild(node, matchType("IDENTIFIER"));
-    addChild(node, matchType("ASSIGN_OPERATOR"));
+    auto *node = makeNode(RK_FOR_STATEMENT);
+    addChild(node, matchKeyword(KW_UNTUK));
+    addChild(node, matchType(TK_IDENTIFIER));
+    addChild(node, matchType(TK_ASSIGN_OPERATOR));
     addChild(node, expression());
     
-    ParseNode* t = tryMatchToken({"KEYWORD", "ke", cur_tok.line, cur_tok.column}); // NOTE
+    ParseNode* t = tryMatchKeyword(KW_KE);
     if (t == nullptr) {
-        t = tryMatchToken({"KEYWORD", "turun-ke", cur_tok.line, cur_tok.column}); // NOTE
+        t = tryMatchKeyword(KW_TURUN_KE);
     }
 
     if (t != nullptr) {
@@ -508,205 +774,210 @@ ParseNode* for_statement() {
     }
 
     addChild(node, expression());
-    addChild(node, matchToken({"KEYWORD", "lakukan", cur_tok.line, cur_tok.column})); // NOTE
+    addChild(node, matchKeyword(KW_LAKUKAN));
 
     addChild(node, compound_statement());
     debugExit("for_statement");
-    return node;
+    return closeNode(node);
 }
 
 // procedure/function-call → IDENTIFIER + (LPARENTHESIS + parameter-list + RPARENTHESIS)
-ParseNode* procedure_function_call() {
+ParseNode* Parser::procedure_function_call() {
     debugEnter("procedure_function_call");
-    auto *node = makeNode("<procedure/function-call>");
-    addChild(node, matchType("IDENTIFIER"));
-    addChild(node, matchType("LPARENTHESIS"));
-    if (cur_tok.type != "RPARENTHESIS")
+    auto *node = makeNode(RK_CALL);
+    addChild(node, matchType(TK_IDENTIFIER));
+    addChild(node, matchType(TK_LPARENTHESIS));
+    if (cur.kind != TK_RPARENTHESIS)
         addChild(node, parameter_list());
-    addChild(node, matchType("RPARENTHESIS"));
+    addChild(node, matchType(TK_RPARENTHESIS));
     debugExit("procedure_function_call");
-    return node;
+    return closeNode(node);
 }
 
 // parameter-list → expression (COMMA + expression)*
-ParseNode* parameter_list() {
+ParseNode* Parser::parameter_list() {
     debugEnter("parameter_list");
-    auto *node = makeNode("<parameter-list>");
+    auto *node = makeNode(RK_PARAMETER_LIST);
     addChild(node, expression());
-    while (cur_tok.type == "COMMA") {
-        addChild(node, makeTokenNode(cur_tok));
+    while (cur.kind == TK_COMMA) {
+        addChild(node, makeTokenNode(cur));
         advance();
         addChild(node, expression());
     }
     debugExit("parameter_list");
-    return node;
+    return closeNode(node);
 }
 
 // expression → simple-expression (RELATIONAL_OPERATOR + simple-expression)?
-ParseNode* expression() {
+ParseNode* Parser::expression() {
     debugEnter("expression");
-    auto *node = makeNode("<expression>");
+    auto *node = makeNode(RK_EXPRESSION);
     addChild(node, simple_expression());
-    if (cur_tok.lexeme == "=" || cur_tok.lexeme == "<>" || cur_tok.lexeme == "<" ||
-        cur_tok.lexeme == "<=" || cur_tok.lexeme == ">" || cur_tok.lexeme == ">=") {
+    if ((isOperator(cur, OP_EQ) || isOperator(cur, OP_NE) || isOperator(cur, OP_LT) ||
+         isOperator(cur, OP_LE) || isOperator(cur, OP_GT) || isOperator(cur, OP_GE))) {
         addChild(node, relational_operator());
         addChild(node, simple_expression());
     }
     debugExit("expression");
-    return node;
+    return closeNode(node);
 }
 
 // simple-expression → (ARITHMETIC_OPERATOR(+/-))? term (additive-operator + term)*
-ParseNode* simple_expression() {
+ParseNode* Parser::simple_expression() {
     debugEnter("simple_expression");
-    auto *node = makeNode("<simple-expression>");
-    if (cur_tok.type == "ARITHMETIC_OPERATOR" &&
-        (cur_tok.lexeme == "+" || cur_tok.lexeme == "-")) {
-        addChild(node, makeTokenNode(cur_tok));
+    auto *node = makeNode(RK_SIMPLE_EXPRESSION);
+    if (cur.kind == TK_ARITHMETIC_OPERATOR &&
+        (isOperator(cur, OP_PLUS) || isOperator(cur, OP_MINUS))) {
+        addChild(node, makeTokenNode(cur));
         advance();
     }
 
     addChild(node, term());
-    while (cur_tok.type == "ARITHMETIC_OPERATOR" || cur_tok.lexeme == "atau") {
+    while (cur.kind == TK_ARITHMETIC_OPERATOR || isOperator(cur, OP_ATAU)) {
         addChild(node, additive_operator());
         addChild(node, term());
     }
     debugExit("simple_expression");
-    return node;
+    return closeNode(node);
 }
 
 // term → factor (multiplicative-operator + factor)*
-ParseNode* term() {
+ParseNode* Parser::term() {
     debugEnter("term");
-    auto *node = makeNode("<term>");
+    auto *node = makeNode(RK_TERM);
     addChild(node, factor());
-    while (cur_tok.lexeme == "*" || cur_tok.lexeme == "/" ||
-           cur_tok.lexeme == "bagi" || cur_tok.lexeme == "mod" ||
-           cur_tok.lexeme == "dan") {
+    while (isOperator(cur, OP_STAR) || isOperator(cur, OP_SLASH) ||
+           isOperator(cur, OP_BAGI) || isOperator(cur, OP_MOD) ||
+           isOperator(cur, OP_DAN)) {
         addChild(node, multiplicative_operator());
         addChild(node, factor());
     }
     debugExit("term");
-    return node;
+    return closeNode(node);
 }
 
 // factor → IDENTIFIER / NUMBER / CHAR_LITERAL / STRING_LITERAL / (LPARENTHESIS + expression + RPARENTHESIS) / LOGICAL_OPERATOR(tidak) + factor / procedure/function-call
-ParseNode* factor() {
+ParseNode* Parser::factor() {
     debugEnter("factor");
-    auto *node = makeNode("<factor>");
-    if (cur_tok.type == "IDENTIFIER") {
-        Token next = (current + 1 < tokens.size()) ? tokens[current + 1] : Token{"EOF", "", 0, 0};
-        if (next.type == "LBRACKET") {
-            addChild(node, makeTokenNode(cur_tok));  
+    auto *node = makeNode(RK_FACTOR);
+    Nested level(*this);
+    if (!level.ok) { debugExit("factor"); return closeNode(node); }
+
+    if (cur.kind == TK_IDENTIFIER) {
+        Token next = lexer.peek(1);
+        if (next.kind == TK_LBRACKET) {
+            addChild(node, makeTokenNode(cur));  
             advance();
-            addChild(node, makeTokenNode(cur_tok)); 
+            addChild(node, makeTokenNode(cur)); 
             advance();
             addChild(node, expression());            
-            addChild(node, matchType("RBRACKET"));
+            addChild(node, matchType(TK_RBRACKET));
         }
-        else if (next.type == "LPARENTHESIS") {
+        else if (next.kind == TK_LPARENTHESIS) {
             addChild(node, procedure_function_call());
         }
         else {
-            addChild(node, makeTokenNode(cur_tok));
+            addChild(node, makeTokenNode(cur));
             advance();
         }
-    } else if (cur_tok.type == "NUMBER" || 
-               cur_tok.type == "CHAR_LITERAL" || 
-               cur_tok.type == "STRING_LITERAL") {
-        addChild(node, makeTokenNode(cur_tok));
+    } else if (cur.kind == TK_NUMBER || 
+               cur.kind == TK_CHAR_LITERAL || 
+               cur.kind == TK_STRING_LITERAL) {
+        addChild(node, makeTokenNode(cur));
         advance();
     } 
-    else if (cur_tok.type == "REAL_NUMBER") {
-        addChild(node, makeTokenNode(cur_tok));
+    else if (cur.kind == TK_REAL_NUMBER) {
+        addChild(node, makeTokenNode(cur));
         advance();
     }
-    else if (cur_tok.type == "BOOLEAN") {
-        addChild(node, makeTokenNode(cur_tok));
+    else if (cur.kind == TK_BOOLEAN) {
+        addChild(node, makeTokenNode(cur));
         advance();
-    } else if (cur_tok.lexeme == "tidak") {
-        addChild(node, makeTokenNode(cur_tok));
+    } else if (isOperator(cur, OP_TIDAK)) {
+        addChild(node, makeTokenNode(cur));
         advance();
         addChild(node, factor());
-    } else if (cur_tok.type == "LPARENTHESIS") {
-        addChild(node, makeTokenNode(cur_tok));
+    } else if (cur.kind == TK_LPARENTHESIS) {
+        addChild(node, makeTokenNode(cur));
         advance();
         addChild(node, expression());
-        addChild(node, matchType("RPARENTHESIS"));
+        addChild(node, matchType(TK_RPARENTHESIS));
     } else {
-        cerr << "Unexpected token in factor: '" << cur_tok.lexeme << "' @ " << cur_tok.line << ":" << cur_tok.column << endl;
+        reportAt("Unexpected token in factor: ");
     }
     debugExit("factor");
-    return node;
+    return closeNode(node);
 }
 
 // relational-operator → =, <>, <, <=, >, >=
-ParseNode* relational_operator() {
+ParseNode* Parser::relational_operator() {
     debugEnter("relational_operator");
-    auto *node = makeNode("<relational-operator>");
-    if (cur_tok.lexeme == "=" || cur_tok.lexeme == "<>" || cur_tok.lexeme == "<" ||
-        cur_tok.lexeme == "<=" || cur_tok.lexeme == ">" || cur_tok.lexeme == ">=") {
-        addChild(node, makeTokenNode(cur_tok));
+    auto *node = makeNode(RK_RELATIONAL_OPERATOR);
+    if (isOperator(cur, OP_EQ) || isOperator(cur, OP_NE) || isOperator(cur, OP_LT) ||
+        isOperator(cur, OP_LE) || isOperator(cur, OP_GT) || isOperator(cur, OP_GE)) {
+        addChild(node, makeTokenNode(cur));
         advance();
     } else {
-        cerr << "Expected relational operator but got '" << cur_tok.lexeme << "' @ " << cur_tok.line << ":" << cur_tok.column << endl;
+        reportAt("Expected relational operator but got ");
         advance();
     }
     debugExit("relational_operator");
-    return node;
+    return closeNode(node);
 }
 
 // additive-operator → +, -, atau
-ParseNode* additive_operator() {
+ParseNode* Parser::additive_operator() {
     debugEnter("additive-operator");
-    auto *node = makeNode("<additive-operator>");
-    if (cur_tok.lexeme == "+" || cur_tok.lexeme == "-" || cur_tok.lexeme == "atau") {
-        addChild(node, makeTokenNode(cur_tok));
+    auto *node = makeNode(RK_ADDITIVE_OPERATOR);
+    if (isOperator(cur, OP_PLUS) || isOperator(cur, OP_MINUS) || isOperator(cur, OP_ATAU)) {
+        addChild(node, makeTokenNode(cur));
         advance();
     } else {
-        cerr << "Expected additive operator but got '" << cur_tok.lexeme << "' @ " << cur_tok.line << ":" << cur_tok.column << endl;
+        reportAt("Expected additive operator but got ");
         advance();
     }
     debugExit("additive-operator");
-    return node;
+    return closeNode(node);
 }
 
 // multiplicative-operator → *, /, bagi, mod, dan
-ParseNode* multiplicative_operator() {
+ParseNode* Parser::multiplicative_operator() {
     debugEnter("multiplicative-operator");
-    auto *node = makeNode("<multiplicative-operator>");
-    if (cur_tok.lexeme == "*" || cur_tok.lexeme == "/" || cur_tok.lexeme == "bagi" ||
-        cur_tok.lexeme == "mod" || cur_tok.lexeme == "dan") {
-        addChild(node, makeTokenNode(cur_tok));
+    auto *node = makeNode(RK_MULTIPLICATIVE_OPERATOR);
+    if (isOperator(cur, OP_STAR) || isOperator(cur, OP_SLASH) || isOperator(cur, OP_BAGI) ||
+        isOperator(cur, OP_MOD) || isOperator(cur, OP_DAN)) {
+        addChild(node, makeTokenNode(cur));
         advance();
     } else {
-        cerr << "Expected multiplicative operator but got '" << cur_tok.lexeme << "' @ " << cur_tok.line << ":" << cur_tok.column << endl;
+        reportAt("Expected multiplicative operator but got ");
         advance();
     }
     debugExit("multiplicative-operator");
-    return node;
+    return closeNode(node);
 }
 
 // ========================
 // BUILD TREE
 // ========================
 
-ParseNode* buildTree(vector<Token> inputTokens) {
-    tokens = inputTokens;
-    current = 0;
-    cur_tok = getCurrentToken();
-
+ParseNode* Parser::parse() {
     auto *root = program();
+    expectEnd();
+    return tooDeep ? nullptr : root;      // the arena still owns it
+}
 
-    if (cur_tok.type != "EOF")
-        cerr << "Syntax error: unexpected token '" << cur_tok.lexeme << "' @ " << cur_tok.line << ":" << cur_tok.column << " after program end\n";
-
-    return root;
+ParseNode* buildTree(Lexer &input, Arena &arena, unsigned maxErrors, unsigned maxDepth, bool trace) {
+    Parser parser(input, arena, trace);
+    parser.setMaxErrors(maxErrors);
+    parser.setMaxDepth(maxDepth);
+    return parser.parse();
 }
 
-ParseNode* parser_main(vector<Token> inputTokens) {
+ParseNode* parser_main(Lexer &input, Arena &arena, unsigned maxErrors, unsigned maxDepth, bool tableDriven,
+                       bool trace) {
     cout << "\n========== Parse Tree ==========\n";
-    auto *root = buildTree(inputTokens);
+    auto *root = tableDriven ? buildTableTree(input, arena, maxErrors, maxDepth)
+                             : buildTree(input, arena, maxErrors, maxDepth, trace);
     if (root) {
         printTree(root);
     }
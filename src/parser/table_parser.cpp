@@ -0,0 +1,103 @@
+#include "table_parser.hpp"
+#include "grammar_gen.hpp"
+#include <vector>
+
+using namespace std;
+
+static const int CLOSE = LL_TERMINALS;      // stack mark: pack the innermost open node
+
+// Column of a token in LL_TABLE
+static int terminalOf(const Token &t) {
+    switch (t.kind) {
+    case TK_KEYWORD:
+        return t.sub < KW_COUNT ? TK_COUNT + t.sub : TK_NONE;
+    case TK_ARITHMETIC_OPERATOR:
+    case TK_RELATIONAL_OPERATOR:
+    case TK_LOGICAL_OPERATOR:
+        return t.sub < OP_COUNT ? TK_COUNT + KW_COUNT + t.sub : TK_NONE;
+    default:
+        return t.kind;
+    }
+}
+
+// Production for a cell that needs the second token, -1 if none fits
+static int bySecond(int entry, int second) {
+    for (const int16_t *s = LL_SECOND + (-2 - entry); *s != -2; s += 2)
+        if (*s == -1 || *s == second) return s[1];
+    return -1;
+}
+
+// Nesting levels as Parser charges them: statements, blocks and factors,
+// each while open (see ParserBase::enterNested)
+static bool takesLevel(RuleKind kind) {
+    return kind == RK_STATEMENT || kind == RK_BLOCK || kind == RK_FACTOR;
+}
+
+ParseNode* TableParser::parse() {
+    stack.assign(1, -1);                    // the start symbol, nonterminal 0
+    open.clear();
+    pending.clear();
+    marks.clear();
+    unsigned depth = 0;
+    // scan() peeks without reporting a lexical error: a failed attempt has
+    // printed nothing, and the fallback parse reports it
+    Token tok = lexer.scan(0);
+    int a = terminalOf(tok);
+
+    while (!stack.empty()) {
+        int x = stack.back();
+        stack.pop_back();
+
+        if (x == CLOSE) {
+            ParseNode *node = open.back();
+            open.pop_back();
+            size_t mark = marks.back();
+            marks.pop_back();
+            size_t n = pending.size() - mark;
+            node->children = Span<ParseNode*>{arena.copyArray(pending.data() + mark, n), n};
+            pending.resize(mark);
+            pending.push_back(node);
+            if (takesLevel(node->rule)) depth--;
+            continue;
+        }
+
+        if (x >= 0) {                       // terminal
+            if (x != a) return nullptr;
+            pending.push_back(arena.make<ParseNode>(ParseNode{RK_TOKEN, tok, {}}));
+            lexer.next();
+            tok = lexer.scan(0);
+            a = terminalOf(tok);
+            continue;
+        }
+
+        int nt = -1 - x;
+        int p = LL_TABLE[nt * LL_TERMINALS + a];
+        if (p < -1) p = bySecond(p, terminalOf(lexer.scan(1)));
+        if (p < 0) return nullptr;
+
+        RuleKind kind = LL_NODE_KIND[nt];
+        if (kind != RK_COUNT) {
+            if (takesLevel(kind)) {
+                if (maxDepth && depth >= maxDepth) return nullptr;
+                depth++;
+            }
+            open.push_back(arena.make<ParseNode>(ParseNode{kind, Token{TK_NONE, 0, 0, 0, 0, 0, Symbol{}}, {}}));
+            marks.push_back(pending.size());
+            stack.push_back(CLOSE);
+        }
+        for (int i = LL_RHS_START[p + 1]; i-- > LL_RHS_START[p];) stack.push_back(LL_RHS[i]);
+    }
+    if (a != TK_EOF) return nullptr;
+    return pending.back();
+}
+
+ParseNode* buildTableTree(Lexer &input, Arena &arena, unsigned maxErrors, unsigned maxDepth) {
+    Arena scratch;                          // dropped with a failed attempt
+    if (ParseNode *root = TableParser(input, scratch, maxDepth).parse()) {
+        arena.adopt(scratch);
+        return root;
+    }
+    // Only for the diagnostics: the program is lexed and parsed again
+    input.restart();
+    return buildTree(input, arena, maxErrors, maxDepth);
+}
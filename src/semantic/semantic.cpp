@@ -3,24 +3,24 @@
 
 using namespace std;
 
-SemanticAnalyzer::SemanticAnalyzer() : hasErrors(false) {
-    initializeBtab();
-    initializeTab();
-    atab.clear();
-}
+static const char ANALYSIS_STARTED[] = "\n========== Semantic Analysis Started ==========\n";
+static const char ANALYSIS_COMPLETED[] = "\n========== Semantic Analysis Completed ==========\n";
+
+SemanticAnalyzer::SemanticAnalyzer() : hasErrors(false) {}
 
 SemanticAnalyzer::~SemanticAnalyzer() {}
 
 string SemanticAnalyzer::inferType(ASTNode* node) {
     if (!node) return "unknown";
     
-    if (node->nodeType == "Number") return "integer";
-    if (node->nodeType == "Real") return "real";
-    if (node->nodeType == "String") return "string";
-    if (node->nodeType == "Char") return "char";
-    if (node->nodeType == "Boolean") return "boolean";
+    switch (node->kind) {
+    case NK_NUMBER: return "integer";
+    case NK_REAL: return "real";
+    case NK_STRING: return "string";
+    case NK_CHAR: return "char";
+    case NK_BOOLEAN: return "boolean";
     
-    if (node->nodeType == "Var") {
+    case NK_VAR: {
         VarNode* varNode = static_cast<VarNode*>(node);
         int idx = lookupIdentifier(varNode->name);
         if (idx > 0 && idx < (int)tab.size()) {
@@ -38,7 +38,7 @@ string SemanticAnalyzer::inferType(ASTNode* node) {
         return "unknown";
     }
     
-    if (node->nodeType == "ProcedureCall") {
+    case NK_PROCEDURE_CALL: {
         ProcedureCallNode* procNode = static_cast<ProcedureCallNode*>(node);
         int idx = lookupIdentifier(procNode->procName);
         if (idx > 0 && idx < (int)tab.size()) {
@@ -53,7 +53,7 @@ string SemanticAnalyzer::inferType(ASTNode* node) {
         return "unknown";
     }
     
-    if (node->nodeType == "ArrayAccess") {
+    case NK_ARRAY_ACCESS: {
         ArrayAccessNode* arrayNode = static_cast<ArrayAccessNode*>(node);
         int idx = lookupIdentifier(arrayNode->arrayName);
         if (idx > 0 && idx < (int)tab.size()) {
@@ -76,19 +76,23 @@ string SemanticAnalyzer::inferType(ASTNode* node) {
         return "unknown";
     }
     
-    if (node->nodeType == "BinOp") {
+    case NK_BIN_OP: {
         BinOpNode* binOp = static_cast<BinOpNode*>(node);
+        // Set once analyzed, so a chain is not walked again at every operator
+        if (!binOp->dataType.empty()) return binOp->dataType.text();
         string leftType = inferType(binOp->left);
         string rightType = inferType(binOp->right);
-        return getOperatorResultType(binOp->op, leftType, rightType);
+        return getOperatorResultType(binOp->op.text(), leftType, rightType);
     }
     
-    if (node->nodeType == "UnaryOp") {
+    case NK_UNARY_OP: {
         UnaryOpNode* unaryOp = static_cast<UnaryOpNode*>(node);
         return inferType(unaryOp->operand);
     }
-    
-    return "unknown";
+
+    default:
+        return "unknown";
+    }
 }
 
 bool SemanticAnalyzer::isCompatibleType(const string& type1, const string& type2) {
@@ -120,10 +124,25 @@ string SemanticAnalyzer::getOperatorResultType(const string& op, const string& l
     return "unknown";
 }
 
-void SemanticAnalyzer::visitProgram(ProgramNode* node) {
-    if (!node) return;
-    
-    cout << "\n========== Semantic Analysis Started ==========\n";
+// Statements and expressions are only walked where they belong
+static bool isStatement(NodeKind kind) {
+    return kind == NK_ASSIGN || kind == NK_IF || kind == NK_WHILE || kind == NK_FOR ||
+           kind == NK_PROCEDURE_CALL || kind == NK_BLOCK;
+}
+
+static bool isExpression(NodeKind kind) {
+    return kind <= NK_UNARY_OP || kind == NK_PROCEDURE_CALL;
+}
+
+void SemanticAnalyzer::statement(ASTNode* node) {
+    if (node && isStatement(node->kind)) walk(node);
+}
+
+void SemanticAnalyzer::expression(ASTNode* node) {
+    if (node && isExpression(node->kind)) walk(node);
+}
+
+bool SemanticAnalyzer::enter(ProgramNode* node) {
     // cout << "Program: " << node->name << endl;
     
     TabEntry progEntry;
@@ -141,51 +160,39 @@ void SemanticAnalyzer::visitProgram(ProgramNode* node) {
     
     node->symbolIndex = progIdx;
     node->scopeLevel = 0;
-    node->dataType = "program";
-    
-    if (node->declarations) {
-        visitDeclarations(node->declarations);
-    }
+    node->dataType = intern("program");
+    return true;
+}
+
+void SemanticAnalyzer::walkChildren(ProgramNode* node) {
+    walk(node->declarations);
     
+    // The main block opens the program's scope
     if (node->block) {
-        visitBlock(node->block);
+        int mainBlockIdx = createNewBlock();
+        enterBlock(mainBlockIdx);
+        node->block->scopeLevel = currentLevel;
+        walk(node->block);
+        exitBlock();
     }
-    
-    cout << "\n========== Semantic Analysis Completed ==========\n";
 }
 
-void SemanticAnalyzer::visitDeclarations(DeclarationsNode* node) {
-    if (!node) return;
-    
+bool SemanticAnalyzer::enter(DeclarationsNode* node) {
     node->scopeLevel = currentLevel;
-    
-    for (ASTNode* decl : node->declarations) {
-        if (!decl) continue;
-        
-        if (decl->nodeType == "VarDecl") {
-            visitVarDecl(static_cast<VarDeclNode*>(decl));
-        }
-        else if (decl->nodeType == "ConstDecl") {
-            visitConstDecl(static_cast<ConstDeclNode*>(decl));
-        }
-        else if (decl->nodeType == "TypeDecl") {
-            visitTypeDecl(static_cast<TypeDeclNode*>(decl));
-        }
-        else if (decl->nodeType == "ProcedureDecl") {
-            visitProcedureDecl(static_cast<ProcedureDeclNode*>(decl));
-        }
-        else if (decl->nodeType == "FunctionDecl") {
-            visitFunctionDecl(static_cast<FunctionDeclNode*>(decl));
-        }
+    return true;
+}
+
+// A compound statement; declarations of a block are visited by its owner
+void SemanticAnalyzer::walkChildren(BlockNode* node) {
+    for (ASTNode* stmt : node->statements) {
+        statement(stmt);
     }
 }
 
-void SemanticAnalyzer::visitVarDecl(VarDeclNode* node) {
-    if (!node) return;
-    
-    for (const string& name : node->names) {
+bool SemanticAnalyzer::enter(VarDeclNode* node) {
+    for (Symbol name : node->names) {
         if (isDuplicateInCurrentBlock(name)) {
-            semanticError("Variable '" + name + "' is already declared in this scope");
+            semanticError("Variable '" + name.text() + "' is already declared in this scope");
             // hasErrors = true;
             // continue;
         }
@@ -229,19 +236,18 @@ void SemanticAnalyzer::visitVarDecl(VarDeclNode* node) {
         
         node->symbolIndex = newIndex;
         node->scopeLevel = currentLevel;
-        node->dataType = node->arrayType ? "array" : node->typeName;
+        node->dataType = node->arrayType ? intern("array") : node->typeName;
         
         // cout << "Variable '" << name << "' at tab[" << newIndex << "] link=" << previousVar << endl;
     }
+    return false;   // the array type went to atab
 }
 
-void SemanticAnalyzer::visitConstDecl(ConstDeclNode* node) {
-    if (!node) return;
-    
+bool SemanticAnalyzer::enter(ConstDeclNode* node) {
     if (isDuplicateInCurrentBlock(node->name)) {
-        semanticError("Constant '" + node->name + "' is already declared in this scope");
+        semanticError("Constant '" + node->name.text() + "' is already declared in this scope");
         // hasErrors = true;
-        return;
+        return false;
     }
     
     string constType = inferType(node->value);
@@ -268,16 +274,15 @@ void SemanticAnalyzer::visitConstDecl(ConstDeclNode* node) {
     
     node->symbolIndex = newIndex;
     node->scopeLevel = currentLevel;
-    node->dataType = constType;
+    node->dataType = intern(constType);
+    return false;
 }
 
-void SemanticAnalyzer::visitTypeDecl(TypeDeclNode* node) {
-    if (!node) return;
-    
+bool SemanticAnalyzer::enter(TypeDeclNode* node) {
     if (isDuplicateInCurrentBlock(node->name)) {
-        semanticError("Type '" + node->name + "' is already declared in this scope");
+        semanticError("Type '" + node->name.text() + "' is already declared in this scope");
         // hasErrors = true;
-        return;
+        return false;
     }
     
     int typeCode = 0;
@@ -312,54 +317,21 @@ void SemanticAnalyzer::visitTypeDecl(TypeDeclNode* node) {
     
     node->symbolIndex = newIndex;
     node->scopeLevel = currentLevel;
-    node->dataType = node->arrayType ? "array" : node->definition;
+    node->dataType = node->arrayType ? intern("array") : node->definition;
+    return false;
 }
 
-void SemanticAnalyzer::visitProcedureDecl(ProcedureDeclNode* node) {
-    if (!node) return;
-    
-    if (isDuplicateInCurrentBlock(node->name)) {
-        semanticError("Procedure '" + node->name + "' is already declared in this scope");
-        // hasErrors = true;
-        return;
-    }
-    
-    int procBlockIdx = createNewBlock();
-    
-    int curBlock = getCurrentBlock();
-    int previousId = btab[curBlock].last;
-    
-    TabEntry e;
-    e.name = node->name;
-    e.link = previousId;
-    e.obj = OBJ_PROCEDURE;
-    e.type = 0;
-    e.ref = procBlockIdx;
-    e.nrm = 1;
-    e.lev = currentLevel;
-    e.adr = 0;
-    e.initialized = false;
-    
-    tab.push_back(e);
-    int procIdx = tab.size() - 1;
-    
-    btab[curBlock].last = procIdx;
-    
-    node->symbolIndex = procIdx;
-    node->scopeLevel = currentLevel;
-    node->dataType = "void";
-    
-    enterBlock(procBlockIdx);
-    
+// Parameters of the subprogram whose block was just entered
+void SemanticAnalyzer::declareParams(Span<ParamNode*> params, int blockIdx) {
     int paramSize = 0;
-    for (ParamNode* param : node->params) {
+    for (ParamNode* param : params) {
         if (!param) continue;
         
         int typeCode = getTypeCode(param->typeName);
         int size = getTypeSize(typeCode);
         
-        for (const string& paramName : param->names) {
-            int prevParam = btab[procBlockIdx].last;
+        for (Symbol paramName : param->names) {
+            int prevParam = btab[blockIdx].last;
             
             TabEntry paramEntry;
             paramEntry.name = paramName;
@@ -375,7 +347,7 @@ void SemanticAnalyzer::visitProcedureDecl(ProcedureDeclNode* node) {
             tab.push_back(paramEntry);
             int paramIdx = tab.size() - 1;
             
-            btab[procBlockIdx].last = paramIdx;
+            btab[blockIdx].last = paramIdx;
             paramSize += size;
             
             param->symbolIndex = paramIdx;
@@ -384,43 +356,78 @@ void SemanticAnalyzer::visitProcedureDecl(ProcedureDeclNode* node) {
         }
     }
     
-    btab[procBlockIdx].psze = paramSize;
-    if (!node->params.empty()) {
-        btab[procBlockIdx].lpar = tab.size() - 1;
+    btab[blockIdx].psze = paramSize;
+    if (!params.empty()) {
+        btab[blockIdx].lpar = tab.size() - 1;
     }
+}
+
+// Local const, type and var declarations, then the statements; nested
+// subprograms are not analyzed
+void SemanticAnalyzer::subprogramBody(BlockNode* body) {
+    if (!body) return;
     
-    if (node->body) {
-        // directly process declarations without creating temporary DeclarationsNode
-        for (ASTNode* decl : node->body->declarations) {
-            if (!decl) continue;
-            
-            if (decl->nodeType == "VarDecl") {
-                visitVarDecl(static_cast<VarDeclNode*>(decl));
-            }
-            else if (decl->nodeType == "ConstDecl") {
-                visitConstDecl(static_cast<ConstDeclNode*>(decl));
-            }
-            else if (decl->nodeType == "TypeDecl") {
-                visitTypeDecl(static_cast<TypeDeclNode*>(decl));
-            }
-        }
-        
-        // Process statements
-        for (ASTNode* stmt : node->body->statements) {
-            visitStatement(stmt);
+    for (ASTNode* decl : body->declarations) {
+        if (decl && (decl->kind == NK_VAR_DECL || decl->kind == NK_CONST_DECL || decl->kind == NK_TYPE_DECL)) {
+            walk(decl);
         }
     }
     
-    exitBlock();
+    for (ASTNode* stmt : body->statements) {
+        statement(stmt);
+    }
 }
 
-void SemanticAnalyzer::visitFunctionDecl(FunctionDeclNode* node) {
-    if (!node) return;
+bool SemanticAnalyzer::enter(ProcedureDeclNode* node) {
+    if (isDuplicateInCurrentBlock(node->name)) {
+        semanticError("Procedure '" + node->name.text() + "' is already declared in this scope");
+        // hasErrors = true;
+        return false;
+    }
+    
+    int procBlockIdx = createNewBlock();
+    
+    int curBlock = getCurrentBlock();
+    int previousId = btab[curBlock].last;
+    
+    TabEntry e;
+    e.name = node->name;
+    e.link = previousId;
+    e.obj = OBJ_PROCEDURE;
+    e.type = 0;
+    e.ref = procBlockIdx;
+    e.nrm = 1;
+    e.lev = currentLevel;
+    e.adr = 0;
+    e.initialized = false;
     
+    tab.push_back(e);
+    int procIdx = tab.size() - 1;
+    
+    btab[curBlock].last = procIdx;
+    
+    node->symbolIndex = procIdx;
+    node->scopeLevel = currentLevel;
+    node->dataType = intern("void");
+    
+    enterBlock(procBlockIdx);
+    declareParams(node->params, procBlockIdx);
+    return true;
+}
+
+void SemanticAnalyzer::walkChildren(ProcedureDeclNode* node) {
+    subprogramBody(node->body);
+}
+
+void SemanticAnalyzer::leave(ProcedureDeclNode*) {
+    exitBlock();
+}
+
+bool SemanticAnalyzer::enter(FunctionDeclNode* node) {
     if (isDuplicateInCurrentBlock(node->name)) {
-        semanticError("Function '" + node->name + "' is already declared in this scope");
+        semanticError("Function '" + node->name.text() + "' is already declared in this scope");
         // hasErrors = true;
-        return;
+        return false;
     }
     
     int funcBlockIdx = createNewBlock();
@@ -450,135 +457,32 @@ void SemanticAnalyzer::visitFunctionDecl(FunctionDeclNode* node) {
     node->dataType = node->returnType;
     
     enterBlock(funcBlockIdx);
-    
-    int paramSize = 0;
-    for (ParamNode* param : node->params) {
-        if (!param) continue;
-        
-        int typeCode = getTypeCode(param->typeName);
-        int size = getTypeSize(typeCode);
-        
-        for (const string& paramName : param->names) {
-            int prevParam = btab[funcBlockIdx].last;
-            
-            TabEntry paramEntry;
-            paramEntry.name = paramName;
-            paramEntry.link = prevParam;
-            paramEntry.obj = OBJ_VARIABLE;
-            paramEntry.type = typeCode;
-            paramEntry.ref = 0;
-            paramEntry.nrm = param->isVar ? 1 : 0;
-            paramEntry.lev = currentLevel;
-            paramEntry.adr = paramSize;
-            paramEntry.initialized = true;
-            
-            tab.push_back(paramEntry);
-            int paramIdx = tab.size() - 1;
-            
-            btab[funcBlockIdx].last = paramIdx;
-            paramSize += size;
-            
-            param->symbolIndex = paramIdx;
-            param->scopeLevel = currentLevel;
-            param->dataType = param->typeName;
-        }
-    }
-    
-    btab[funcBlockIdx].psze = paramSize;
-    if (!node->params.empty()) {
-        btab[funcBlockIdx].lpar = tab.size() - 1;
-    }
-    
-    if (node->body) {
-        // this too
-        for (ASTNode* decl : node->body->declarations) {
-            if (!decl) continue;
-            
-            if (decl->nodeType == "VarDecl") {
-                visitVarDecl(static_cast<VarDeclNode*>(decl));
-            }
-            else if (decl->nodeType == "ConstDecl") {
-                visitConstDecl(static_cast<ConstDeclNode*>(decl));
-            }
-            else if (decl->nodeType == "TypeDecl") {
-                visitTypeDecl(static_cast<TypeDeclNode*>(decl));
-            }
-        }
-        
-        // Process statements
-        for (ASTNode* stmt : node->body->statements) {
-            visitStatement(stmt);
-        }
-    }
-    
-    exitBlock();
+    declareParams(node->params, funcBlockIdx);
+    return true;
 }
 
-void SemanticAnalyzer::visitBlock(BlockNode* node) {
-    if (!node) return;
-    
-    int mainBlockIdx = createNewBlock();
-    enterBlock(mainBlockIdx);
-    
-    node->scopeLevel = currentLevel;
+void SemanticAnalyzer::walkChildren(FunctionDeclNode* node) {
+    subprogramBody(node->body);
+}
 
-    // // Process declarations
-    // for (ASTNode* decl : node->declarations) {
-    //     if (decl->nodeType == "VarDecl") {
-    //         visitVarDecl(static_cast<VarDeclNode*>(decl));
-    //     }
-    //     else if (decl->nodeType == "ConstDecl") {
-    //         visitConstDecl(static_cast<ConstDeclNode*>(decl));
-    //     }
-    //     else if (decl->nodeType == "TypeDecl") {
-    //         visitTypeDecl(static_cast<TypeDeclNode*>(decl));
-    //     }
-    // }
-    
-    for (ASTNode* stmt : node->statements) {
-        visitStatement(stmt);
-    }
-    
+void SemanticAnalyzer::leave(FunctionDeclNode*) {
     exitBlock();
 }
 
-void SemanticAnalyzer::visitStatement(ASTNode* node) {
-    if (!node) return;
-    
-    if (node->nodeType == "Assign") {
-        visitAssign(static_cast<AssignNode*>(node));
-    }
-    else if (node->nodeType == "If") {
-        visitIf(static_cast<IfNode*>(node));
-    }
-    else if (node->nodeType == "While") {
-        visitWhile(static_cast<WhileNode*>(node));
-    }
-    else if (node->nodeType == "For") {
-        visitFor(static_cast<ForNode*>(node));
-    }
-    else if (node->nodeType == "ProcedureCall") {
-        visitProcedureCall(static_cast<ProcedureCallNode*>(node));
-    }
-    else if (node->nodeType == "Block") {
-        for (ASTNode* stmt : static_cast<BlockNode*>(node)->statements) {
-            visitStatement(stmt);
-        }
-    }
+bool SemanticAnalyzer::enter(AssignNode* node) {
+    checkAssignmentTarget(node->target);
+    return true;
 }
 
-void SemanticAnalyzer::visitAssign(AssignNode* node) {
-    if (!node) return;
-
-    checkAssignmentTarget(node->target);
-    visitExpression(node->value);
+void SemanticAnalyzer::walkChildren(AssignNode* node) {
+    expression(node->value);
     
     if (node->target) {
         int idx = -1;
-        if (node->target->nodeType == "Var") {
+        if (node->target->kind == NK_VAR) {
             VarNode* varNode = static_cast<VarNode*>(node->target);
             idx = lookupIdentifier(varNode->name);
-        } else if (node->target->nodeType == "ArrayAccess") {
+        } else if (node->target->kind == NK_ARRAY_ACCESS) {
             ArrayAccessNode* arrayNode = static_cast<ArrayAccessNode*>(node->target);
             idx = lookupIdentifier(arrayNode->arrayName);
         }
@@ -589,7 +493,7 @@ void SemanticAnalyzer::visitAssign(AssignNode* node) {
             // assignment ke const gk boleh
             if (lhsEntry.obj == OBJ_CONSTANT) {
                 semanticError(
-                    "Cannot assign to constant '" + lhsEntry.name + "'"
+                    "Cannot assign to constant '" + lhsEntry.name.text() + "'"
                 );
             }
 
@@ -601,66 +505,69 @@ void SemanticAnalyzer::visitAssign(AssignNode* node) {
     }
 
     
-    visitExpression(node->target);
-    
+    expression(node->target);
+}
+
+void SemanticAnalyzer::leave(AssignNode* node) {
+    // A missing side was already reported as a syntax error
+    if (!node->target || !node->value) return;
+
     string targetType = inferType(node->target);
     string valueType = inferType(node->value);
 
-    if (node->value->nodeType == "Var" && valueType == "unknown") {
+    if (node->value->kind == NK_VAR && valueType == "unknown") {
         // Kalau VarNode tapi undefined, tetap beri type "unknown"
         valueType = "unknown";
     }
 
-    string varName = "";
-    if (node->target->nodeType == "Var") {
+    Symbol varName;
+    if (node->target->kind == NK_VAR) {
         varName = static_cast<VarNode*>(node->target)->name;
-    } else if (node->target->nodeType == "ArrayAccess") {
+    } else if (node->target->kind == NK_ARRAY_ACCESS) {
         varName = static_cast<ArrayAccessNode*>(node->target)->arrayName;
     }
     
     if (targetType == "integer" && valueType == "real") {
-        semanticError("Cannot assign real value to integer variable '" + varName + "' (type: " + targetType + " := " + valueType + ")");
+        semanticError("Cannot assign real value to integer variable '" + varName.text() + "' (type: " + targetType + " := " + valueType + ")");
     }
     
     if (!isCompatibleType(targetType, valueType)) {
-        semanticError("Type mismatch in assignment to '" + varName + "': cannot assign '" + valueType + "' to '" + targetType + "'");
+        semanticError("Type mismatch in assignment to '" + varName.text() + "': cannot assign '" + valueType + "' to '" + targetType + "'");
     }
     
-    node->dataType = targetType;
+    node->dataType = intern(targetType);
     node->scopeLevel = currentLevel;
 }
 
-void SemanticAnalyzer::visitIf(IfNode* node) {
-    if (!node) return;
-    
-    visitExpression(node->condition);
+void SemanticAnalyzer::walkChildren(IfNode* node) {
+    expression(node->condition);
     checkCondition(node->condition, "If");
     
-    if (node->thenBranch) visitStatement(node->thenBranch);
-    if (node->elseBranch) visitStatement(node->elseBranch);
-    
+    statement(node->thenBranch);
+    statement(node->elseBranch);
+}
+
+void SemanticAnalyzer::leave(IfNode* node) {
     node->scopeLevel = currentLevel;
 }
 
-void SemanticAnalyzer::visitWhile(WhileNode* node) {
-    if (!node) return;
-    
-    visitExpression(node->condition);
+void SemanticAnalyzer::walkChildren(WhileNode* node) {
+    expression(node->condition);
     checkCondition(node->condition, "While");
-    if (node->body) visitStatement(node->body);
-    
+    statement(node->body);
+}
+
+void SemanticAnalyzer::leave(WhileNode* node) {
     node->scopeLevel = currentLevel;
 }
 
-void SemanticAnalyzer::visitFor(ForNode* node) {
-    if (!node) return;
-    
-    visitExpression(node->start);
-    visitExpression(node->end);
+void SemanticAnalyzer::walkChildren(ForNode* node) {
+    expression(node->start);
+    expression(node->end);
 
     checkForLoop(node);
     
-    if (node->counter && node->counter->nodeType == "Var") {
+    if (node->counter && node->counter->kind == NK_VAR) {
         VarNode* counterVar = static_cast<VarNode*>(node->counter);
         int idx = lookupIdentifier(counterVar->name);
         if (idx > 0 && idx < (int)tab.size()) {
@@ -670,107 +577,83 @@ void SemanticAnalyzer::visitFor(ForNode* node) {
         }
     }
     
-    visitExpression(node->counter);
-    
-    if (node->body) visitStatement(node->body);
+    expression(node->counter);
     
+    statement(node->body);
+}
+
+void SemanticAnalyzer::leave(ForNode* node) {
     node->scopeLevel = currentLevel;
 }
 
-void SemanticAnalyzer::visitProcedureCall(ProcedureCallNode* node) {
-    if (!node) return;
-    
+bool SemanticAnalyzer::enter(ProcedureCallNode* node) {
     int idx = lookupIdentifier(node->procName);
     if (idx == 0) {
-        semanticError("Undefined procedure '" + node->procName + "'");
+        semanticError("Undefined procedure '" + node->procName.text() + "'");
         // hasErrors = true;
     } else {
         node->symbolIndex = idx;
         checkProcedureCall(node);
     }
-    
+    return true;
+}
+
+void SemanticAnalyzer::walkChildren(ProcedureCallNode* node) {
     for (ASTNode* arg : node->args) {
-        visitExpression(arg);
+        expression(arg);
     }
-    
-    node->scopeLevel = currentLevel;
-    node->dataType = inferType(node);
 }
 
-void SemanticAnalyzer::visitExpression(ASTNode* node) {
-    if (!node) return;
-    
-    if (node->nodeType == "Var") {
-        visitVar(static_cast<VarNode*>(node));
-    }
-    else if (node->nodeType == "ArrayAccess") {
-        visitArrayAccess(static_cast<ArrayAccessNode*>(node));
-    }
-    else if (node->nodeType == "BinOp") {
-        visitBinOp(static_cast<BinOpNode*>(node));
-    }
-    else if (node->nodeType == "UnaryOp") {
-        visitUnaryOp(static_cast<UnaryOpNode*>(node));
-    }
-    else if (node->nodeType == "Number") {
-        node->dataType = "integer";
-        node->scopeLevel = currentLevel;
-    }
-    else if (node->nodeType == "Real") {
-        node->dataType = "real";
-        node->scopeLevel = currentLevel;
-    }
-    else if (node->nodeType == "String") {
-        node->dataType = "string";
-        node->scopeLevel = currentLevel;
-    }
-    else if (node->nodeType == "Char") {
-        node->dataType = "char";
-        node->scopeLevel = currentLevel;
-    }
-    else if (node->nodeType == "Boolean") {
-        node->dataType = "boolean";
-        node->scopeLevel = currentLevel;
-    }
-    else if (node->nodeType == "ProcedureCall") {
-        visitProcedureCall(static_cast<ProcedureCallNode*>(node));
-    }
+void SemanticAnalyzer::leave(ProcedureCallNode* node) {
+    node->scopeLevel = currentLevel;
+    node->dataType = intern(inferType(node));
 }
 
-void SemanticAnalyzer::visitVar(VarNode* node) {
-    if (!node) return;
-    
+bool SemanticAnalyzer::enter(VarNode* node) {
     int idx = lookupIdentifier(node->name);
     
     if (idx == 0) {
-        semanticError("Undefined variable '" + node->name + "'");
+        semanticError("Undefined variable '" + node->name.text() + "'");
         // hasErrors = true;
     } else {
         node->symbolIndex = idx;
         node->scopeLevel = tab[idx].lev;
-        node->dataType = inferType(node);
+        node->dataType = intern(inferType(node));
         
         // Check if variable is initialized before use
         if (tab[idx].obj == OBJ_VARIABLE && !tab[idx].initialized) {
-            semanticError("Variable '" + node->name + "' might be used before being assigned a value");
+            semanticError("Variable '" + node->name.text() + "' might be used before being assigned a value");
         }
     }
+    return false;
 }
 
-void SemanticAnalyzer::visitArrayAccess(ArrayAccessNode* node) {
-    if (!node) return;
+bool SemanticAnalyzer::literal(ASTNode* node, const char* type) {
+    node->dataType = intern(type);
+    node->scopeLevel = currentLevel;
+    return false;
+}
+
+bool SemanticAnalyzer::enter(NumberNode* node) { return literal(node, "integer"); }
+bool SemanticAnalyzer::enter(RealNode* node) { return literal(node, "real"); }
+bool SemanticAnalyzer::enter(StringNode* node) { return literal(node, "string"); }
+bool SemanticAnalyzer::enter(CharNode* node) { return literal(node, "char"); }
+bool SemanticAnalyzer::enter(BoolNode* node) { return literal(node, "boolean"); }
 
+void SemanticAnalyzer::walkChildren(ArrayAccessNode* node) {
     // First analyze index expression
-    visitExpression(node->index);
+    expression(node->index);
+}
 
+void SemanticAnalyzer::leave(ArrayAccessNode* node) {
     int idx = lookupIdentifier(node->arrayName);
     if (idx == 0) {
-        semanticError("Undefined array '" + node->arrayName + "'");
+        semanticError("Undefined array '" + node->arrayName.text() + "'");
         return;
     }
 
     if (tab[idx].type != 5) { // Not array
-        semanticError("'" + node->arrayName + "' is not an array");
+        semanticError("'" + node->arrayName.text() + "' is not an array");
         return;
     }
 
@@ -781,6 +664,12 @@ void SemanticAnalyzer::visitArrayAccess(ArrayAccessNode* node) {
     int expectedIndexType = atab[atab_idx].xtyp;
     string expectedTypeName = getTypeName(expectedIndexType);
 
+    // A missing index was already reported as a syntax error
+    if (!node->index) {
+        node->dataType = intern(getTypeName(atab[atab_idx].etyp));
+        return;
+    }
+
     string indexType = inferType(node->index);
     if (indexType != expectedTypeName && indexType != "integer") {
         semanticError("Array index type mismatch: expected '" + expectedTypeName +
@@ -788,7 +677,8 @@ void SemanticAnalyzer::visitArrayAccess(ArrayAccessNode* node) {
     }
 
     // out of bounds check
-    if (node->index->nodeType == "Number") {
+    switch (node->index->kind) {
+    case NK_NUMBER: {
         NumberNode* numIndex = static_cast<NumberNode*>(node->index);
         int idxVal = numIndex->value;
 
@@ -798,11 +688,12 @@ void SemanticAnalyzer::visitArrayAccess(ArrayAccessNode* node) {
         if (idxVal < low || idxVal > high) {
             semanticError("Array index " + to_string(idxVal) +
                           " out of bounds [" + to_string(low) + ".." +
-                          to_string(high) + "] for array '" + node->arrayName + "'");
+                          to_string(high) + "] for array '" + node->arrayName.text() + "'");
         }
+        break;
     }
 
-    else if (node->index->nodeType == "Char") {
+    case NK_CHAR: {
         CharNode* charIndex = static_cast<CharNode*>(node->index);
         char idxVal = charIndex->value;
         int intVal = static_cast<int>(idxVal);
@@ -812,11 +703,12 @@ void SemanticAnalyzer::visitArrayAccess(ArrayAccessNode* node) {
 
         if (intVal < low || intVal > high) {
             semanticError("Array index '" + string(1, idxVal) + "' (" + to_string(intVal) +
-                         ") out of bounds for array '" + node->arrayName + "'");
+                         ") out of bounds for array '" + node->arrayName.text() + "'");
         }
+        break;
     }
 
-    else if (node->index->nodeType == "Boolean") {
+    case NK_BOOLEAN: {
         BoolNode* boolIndex = static_cast<BoolNode*>(node->index);
         bool idxVal = boolIndex->value;
         int intVal = idxVal ? 1 : 0;
@@ -827,52 +719,61 @@ void SemanticAnalyzer::visitArrayAccess(ArrayAccessNode* node) {
         if (intVal < low || intVal > high) {
             string boolStr = idxVal ? "true" : "false";
             semanticError("Array index '" + boolStr + "' (" + to_string(intVal) +
-                         ") out of bounds for array '" + node->arrayName + "'");
+                         ") out of bounds for array '" + node->arrayName.text() + "'");
         }
+        break;
+    }
+
+    default:
+        break;
     }
 
     // element type
-    node->dataType = getTypeName(atab[atab_idx].etyp);
+    node->dataType = intern(getTypeName(atab[atab_idx].etyp));
 }
 
 
-void SemanticAnalyzer::visitBinOp(BinOpNode* node) {
-    if (!node) return;
-    
-    visitExpression(node->left);
-    visitExpression(node->right);
+bool SemanticAnalyzer::walkLeft(BinOpNode* node) {
+    return node->left && isExpression(node->left->kind);
+}
+
+void SemanticAnalyzer::walkRight(BinOpNode* node) {
+    expression(node->right);
+}
 
+void SemanticAnalyzer::leave(BinOpNode* node) {
     checkBinaryOperation(node);
     
-    node->dataType = inferType(node);
+    node->dataType = intern(inferType(node));
     node->scopeLevel = currentLevel;
 }
 
-void SemanticAnalyzer::visitUnaryOp(UnaryOpNode* node) {
-    if (!node) return;
-    
-    visitExpression(node->operand);
+void SemanticAnalyzer::walkChildren(UnaryOpNode* node) {
+    expression(node->operand);
+}
+
+void SemanticAnalyzer::leave(UnaryOpNode* node) {
     checkUnaryOperation(node);
     
-    node->dataType = inferType(node);
+    node->dataType = intern(inferType(node));
     node->scopeLevel = currentLevel;
 }
 
 void SemanticAnalyzer::checkAssignmentTarget(ASTNode* target) {
     if (!target) return;
     
-    if (target->nodeType == "Var") {
+    if (target->kind == NK_VAR) {
         VarNode* varNode = static_cast<VarNode*>(target);
         int idx = lookupIdentifier(varNode->name);
         if (idx > 0 && idx < (int)tab.size()) {
             // Cannot assign to constant
             if (tab[idx].obj == OBJ_CONSTANT) {
-                semanticError("Cannot assign to constant '" + varNode->name + "'");
+                semanticError("Cannot assign to constant '" + varNode->name.text() + "'");
                 // hasErrors = true;
             }
             // Cannot assign to procedure/function name
             else if (tab[idx].obj == OBJ_PROCEDURE) {
-                semanticError("Cannot assign to procedure '" + varNode->name + "'");
+                semanticError("Cannot assign to procedure '" + varNode->name.text() + "'");
                 // hasErrors = true;
             }
         }
@@ -880,11 +781,11 @@ void SemanticAnalyzer::checkAssignmentTarget(ASTNode* target) {
 }
 
 void SemanticAnalyzer::checkBinaryOperation(BinOpNode* node) {
-    if (!node) return;
+    if (!node || !node->left || !node->right) return;   // missing operands are syntax errors
     
     string leftType = inferType(node->left);
     string rightType = inferType(node->right);
-    string op = node->op;
+    string op = node->op.text();
     
     // Arithmetic operators: +, -, *, /, bagi, mod
     if (op == "+" || op == "-" || op == "*" || op == "/" || op == "bagi" || op == "mod") {
@@ -930,10 +831,10 @@ void SemanticAnalyzer::checkBinaryOperation(BinOpNode* node) {
 }
 
 void SemanticAnalyzer::checkUnaryOperation(UnaryOpNode* node) {
-    if (!node) return;
+    if (!node || !node->operand) return;
     
     string operandType = inferType(node->operand);
-    string op = node->op;
+    string op = node->op.text();
     
     // Logical "tidak"
     if (op == "tidak") {
@@ -960,7 +861,7 @@ void SemanticAnalyzer::checkArrayAccess(ArrayAccessNode* node) {
     if (idx > 0 && idx < (int)tab.size()) {
         // Must be array type
         if (tab[idx].type != 5) { // 5 = array type code
-            semanticError("'" + node->arrayName + "' is not an array");
+            semanticError("'" + node->arrayName.text() + "' is not an array");
             // hasErrors = true;
             return;
         }
@@ -1002,7 +903,7 @@ void SemanticAnalyzer::checkProcedureCall(ProcedureCallNode* node) {
         
         // Must be procedure or function
         if (objType != OBJ_PROCEDURE && objType != OBJ_FUNCTION) {
-            semanticError("'" + node->procName + "' is not a procedure or function");
+            semanticError("'" + node->procName.text() + "' is not a procedure or function");
             // hasErrors = true;
             return;
         }
@@ -1021,14 +922,13 @@ void SemanticAnalyzer::checkProcedureCall(ProcedureCallNode* node) {
             }
             
             // Skip check for built-in procedures (writeln, readln, etc)
-            if (node->procName == "writeln" || node->procName == "write" || 
-                node->procName == "readln" || node->procName == "read") {
+            if (isBuiltinProcedure(node->procName)) {
                 return; // These accept variable arguments
             }
             
             // Check argument count
             if ((int)node->args.size() != paramCount) {
-                semanticError("'" + node->procName + "' expects " + to_string(paramCount) + 
+                semanticError("'" + node->procName.text() + "' expects " + to_string(paramCount) + 
                             " arguments, got " + to_string(node->args.size()));
                 // hasErrors = true;
             }
@@ -1041,7 +941,7 @@ void SemanticAnalyzer::checkForLoop(ForNode* node) {
     
     string expectedType = ""; 
     
-    if (node->counter->nodeType == "Var") {
+    if (node->counter->kind == NK_VAR) {
         VarNode* counterVar = static_cast<VarNode*>(node->counter);
         int idx = lookupIdentifier(counterVar->name);
         
@@ -1051,7 +951,7 @@ void SemanticAnalyzer::checkForLoop(ForNode* node) {
             bool isOrdinal = (typeCode == 1 || typeCode == 3 || typeCode == 4);
 
             if (!isOrdinal) { 
-                semanticError("For loop counter '" + counterVar->name + "' must be an ordinal type (Integer, Char, or Boolean)");
+                semanticError("For loop counter '" + counterVar->name.text() + "' must be an ordinal type (Integer, Char, or Boolean)");
             } else {
                 if (typeCode == 1) expectedType = "integer";
                 else if (typeCode == 3) expectedType = "boolean";
@@ -1070,30 +970,37 @@ void SemanticAnalyzer::checkForLoop(ForNode* node) {
     string startType = inferType(node->start);
     string endType = inferType(node->end);
     
-    if (startType != expectedType) {
+    if (node->start && startType != expectedType) {
         semanticError("For loop start value type mismatch. Expected '" + expectedType + 
                       "' (counter type), but got '" + startType + "'");
     }
 
-    if (endType != expectedType) {
+    if (node->end && endType != expectedType) {
         semanticError("For loop end value type mismatch. Expected '" + expectedType + 
                       "' (counter type), but got '" + endType + "'");
     }
 }
 
 bool SemanticAnalyzer::analyze(ASTNode* root) {
+    // Every analysis starts from fresh tables
+    initializeBtab();
+    initializeTab();
+    atab.clear();
+
     if (!root) {
         cerr << "Error: AST root is null\n";
         return false;
     }
     
-    if (root->nodeType != "Program") {
+    if (root->kind != NK_PROGRAM) {
         cerr << "Error: Root must be Program\n";
         return false;
     }
     
     try {
-        visitProgram(static_cast<ProgramNode*>(root));
+        cout << ANALYSIS_STARTED;
+        walk(root);
+        cout << ANALYSIS_COMPLETED;
         return !hasErrors;
     } catch (const exception& e) {
         cerr << "Semantic analysis failed: " << e.what() << endl;
@@ -1124,270 +1031,111 @@ string SemanticAnalyzer::getObjectName(int objCode) {
     }
 }
 
-void SemanticAnalyzer::printDecoratedAST(ASTNode* node, const string& prefix, bool isLast) {
-    if (!node) return;
-    
-    cout << prefix;
-    cout << (isLast ? "└── " : "├── ");
-    
-    // Print node type
-    cout << node->nodeType;
-    
-    // Print basic info
-    if (node->nodeType == "Number") {
-        cout << "(" << static_cast<NumberNode*>(node)->value << ")";
-    }
-    else if (node->nodeType == "Real") {
-        cout << "(" << static_cast<RealNode*>(node)->value << ")";
-    }
-    else if (node->nodeType == "String") {
-        cout << "(\"" << static_cast<StringNode*>(node)->value << "\")";
-    }
-    else if (node->nodeType == "Char") {
-        cout << "('" << static_cast<CharNode*>(node)->value << "')";
-    }
-    else if (node->nodeType == "Boolean") {
-        cout << "(" << (static_cast<BoolNode*>(node)->value ? "true" : "false") << ")";
-    }
-    else if (node->nodeType == "Var") {
-        cout << "('" << static_cast<VarNode*>(node)->name << "')";
-    }
-    else if (node->nodeType == "ArrayAccess") {
-        cout << ": " << static_cast<ArrayAccessNode*>(node)->arrayName;
-    }
-    else if (node->nodeType == "BinOp") {
-        cout << "('" << static_cast<BinOpNode*>(node)->op << "')";
-    }
-    else if (node->nodeType == "UnaryOp") {
-        cout << "('" << static_cast<UnaryOpNode*>(node)->op << "')";
-    }
-    else if (node->nodeType == "Program") {
-        cout << "(name: '" << static_cast<ProgramNode*>(node)->name << "')";
-    }
-    else if (node->nodeType == "VarDecl") {
-        VarDeclNode* vd = static_cast<VarDeclNode*>(node);
-        cout << "(name: '" << vd->names[0] << "')";
-    }
-    else if (node->nodeType == "ConstDecl") {
-        ConstDeclNode* cd = static_cast<ConstDeclNode*>(node);
-        cout << "(name: '" << cd->name << "')";
-    }
-    else if (node->nodeType == "TypeDecl") {
-        TypeDeclNode* td = static_cast<TypeDeclNode*>(node);
-        cout << "(name: '" << td->name << "')";
-    }
-    else if (node->nodeType == "ProcedureDecl") {
-        ProcedureDeclNode* pd = static_cast<ProcedureDeclNode*>(node);
-        cout << "(name: '" << pd->name << "')";
-    }
-    else if (node->nodeType == "FunctionDecl") {
-        FunctionDeclNode* fd = static_cast<FunctionDeclNode*>(node);
-        cout << "(name: '" << fd->name << "')";
-    }
-    else if (node->nodeType == "ProcedureCall") {
-        cout << "(name: '" << static_cast<ProcedureCallNode*>(node)->procName << "')";
-    }
-    
-    // Print decorations
-    cout << " → ";
-    
-    // Print tab_index if available
-    if (node->symbolIndex >= 0) {
-        cout << "tab_index:" << node->symbolIndex;
-        
-        // Print detailed info from symbol table
-        if (node->symbolIndex < (int)tab.size()) {
-            TabEntry& entry = tab[node->symbolIndex];
-            cout << ", obj:" << getObjectName(entry.obj);
-        }
-        cout << ", ";
-    }
-    
-    // Print type
-    if (!node->dataType.empty()) {
-        cout << "type:'" << node->dataType << "'";
-    } else {
-        cout << "type:void";
-    }
-    
-    // Print level
-    if (node->scopeLevel >= 0) {
-        cout << ", lev:" << node->scopeLevel;
-    }
-    
-    cout << endl;
-    
-    string newPrefix = prefix + (isLast ? "    " : "│   ");
-    
-    // Traverse children based on node type
-    if (node->nodeType == "Program") {
-        ProgramNode* prog = static_cast<ProgramNode*>(node);
-        size_t totalChildren = (prog->declarations ? 1 : 0) + (prog->block ? 1 : 0);
-        size_t count = 0;
-        
-        if (prog->declarations) {
-            count++;
-            printDecoratedAST(prog->declarations, newPrefix, count == totalChildren);
-        }
-        if (prog->block) {
-            printDecoratedAST(prog->block, newPrefix, true);
-        }
-    }
-    else if (node->nodeType == "Declarations") {
-        DeclarationsNode* decls = static_cast<DeclarationsNode*>(node);
-        for (size_t i = 0; i < decls->declarations.size(); i++) {
-            printDecoratedAST(decls->declarations[i], newPrefix, i + 1 == decls->declarations.size());
-        }
-    }
-    else if (node->nodeType == "Block") {
-        BlockNode* block = static_cast<BlockNode*>(node);
-        size_t totalChildren = block->declarations.size() + block->statements.size();
-        size_t count = 0;
-        
-        for (size_t i = 0; i < block->declarations.size(); i++) {
-            count++;
-            printDecoratedAST(block->declarations[i], newPrefix, count == totalChildren);
-        }
-        for (size_t i = 0; i < block->statements.size(); i++) {
-            count++;
-            printDecoratedAST(block->statements[i], newPrefix, count == totalChildren);
-        }
-    }
-    else if (node->nodeType == "VarDecl") {
-        VarDeclNode* vd = static_cast<VarDeclNode*>(node);
-        if (vd->arrayType) {
-            printDecoratedAST(vd->arrayType, newPrefix, true);
-        }
-    }
-    else if (node->nodeType == "TypeDecl") {
-        TypeDeclNode* td = static_cast<TypeDeclNode*>(node);
-        if (td->arrayType) {
-            printDecoratedAST(td->arrayType, newPrefix, true);
-        }
-    }
-    else if (node->nodeType == "ProcedureDecl") {
-        ProcedureDeclNode* pd = static_cast<ProcedureDeclNode*>(node);
-        if (pd->body) {
-            printDecoratedAST(pd->body, newPrefix, true);
-        }
-    }
-    else if (node->nodeType == "FunctionDecl") {
-        FunctionDeclNode* fd = static_cast<FunctionDeclNode*>(node);
-        if (fd->body) {
-            printDecoratedAST(fd->body, newPrefix, true);
-        }
-    }
-    else if (node->nodeType == "Assign") {
-        AssignNode* an = static_cast<AssignNode*>(node);
-        if (an->target) {
-            printDecoratedAST(an->target, newPrefix, !an->value);
-        }
-        if (an->value) {
-            printDecoratedAST(an->value, newPrefix, true);
-        }
-    }
-    else if (node->nodeType == "BinOp") {
-        BinOpNode* bn = static_cast<BinOpNode*>(node);
-        if (bn->left) {
-            printDecoratedAST(bn->left, newPrefix, !bn->right);
-        }
-        if (bn->right) {
-            printDecoratedAST(bn->right, newPrefix, true);
-        }
-    }
-    else if (node->nodeType == "UnaryOp") {
-        UnaryOpNode* un = static_cast<UnaryOpNode*>(node);
-        if (un->operand) {
-            printDecoratedAST(un->operand, newPrefix, true);
-        }
-    }
-    else if (node->nodeType == "ArrayAccess") {
-        ArrayAccessNode* aan = static_cast<ArrayAccessNode*>(node);
-        if (aan->index) {
-            printDecoratedAST(aan->index, newPrefix, true);
-        }
-    }
-    else if (node->nodeType == "If") {
-        IfNode* ifn = static_cast<IfNode*>(node);
-        size_t childCount = (ifn->condition ? 1 : 0) + (ifn->thenBranch ? 1 : 0) + (ifn->elseBranch ? 1 : 0);
-        size_t count = 0;
-        
-        if (ifn->condition) {
-            count++;
-            printDecoratedAST(ifn->condition, newPrefix, count == childCount);
-        }
-        if (ifn->thenBranch) {
-            count++;
-            printDecoratedAST(ifn->thenBranch, newPrefix, count == childCount);
-        }
-        if (ifn->elseBranch) {
-            count++;
-            printDecoratedAST(ifn->elseBranch, newPrefix, count == childCount);
-        }
-    }
-    else if (node->nodeType == "While") {
-        WhileNode* wn = static_cast<WhileNode*>(node);
-        if (wn->condition) {
-            printDecoratedAST(wn->condition, newPrefix, !wn->body);
-        }
-        if (wn->body) {
-            printDecoratedAST(wn->body, newPrefix, true);
-        }
+// ========== DECORATED TREE ==========
+
+// Whether child c of p is drawn as p's last child. Absent fixed slots do
+// not count, list entries do (as ASTVisitor::eachChild has it); a For
+// marks its body last only when all four slots are present.
+static bool drawnLast(const FlatAST& ast, uint32_t p, uint32_t c) {
+    const FlatNode& parent = ast.nodes[p];
+    switch (parent.kind) {
+    case NK_PROCEDURE_CALL: case NK_BLOCK: case NK_DECLARATIONS:
+        return ast.nodes[c].end == parent.end;
+    case NK_FOR:
+        for (uint32_t k : ast.children(p)) if (ast.nodes[k].kind == FK_EMPTY) return false;
+        return ast.nodes[c].end == parent.end;
+    default:
+        for (uint32_t k = ast.nodes[c].end; k < parent.end; k = ast.nodes[k].end)
+            if (ast.nodes[k].kind != FK_EMPTY) return false;
+        return true;
     }
-    else if (node->nodeType == "For") {
-        ForNode* fn = static_cast<ForNode*>(node);
-        size_t childCount = 4; // counter, start, end, body
-        size_t count = 0;
-        
-        if (fn->counter) {
-            count++;
-            printDecoratedAST(fn->counter, newPrefix, count == childCount);
-        }
-        if (fn->start) {
-            count++;
-            printDecoratedAST(fn->start, newPrefix, count == childCount);
-        }
-        if (fn->end) {
-            count++;
-            printDecoratedAST(fn->end, newPrefix, count == childCount);
-        }
-        if (fn->body) {
-            count++;
-            printDecoratedAST(fn->body, newPrefix, count == childCount);
-        }
-    }
-    else if (node->nodeType == "ProcedureCall") {
-        ProcedureCallNode* pc = static_cast<ProcedureCallNode*>(node);
-        for (size_t i = 0; i < pc->args.size(); i++) {
-            bool isLast = (i + 1 == pc->args.size());
-            printDecoratedAST(pc->args[i], newPrefix, isLast);
-        }
+}
+
+// What follows the kind on a node's line, before the decorations
+static void describe(const FlatAST& ast, const FlatNode& f) {
+    switch (f.kind) {
+    case NK_NUMBER: cout << "(" << (int)f.a << ")"; break;
+    case NK_REAL: cout << "(" << ast.reals[f.a] << ")"; break;
+    case NK_STRING: cout << "(\"" << ast.strings[f.a] << "\")"; break;
+    case NK_CHAR: cout << "('" << (char)f.a << "')"; break;
+    case NK_BOOLEAN: cout << "(" << (f.a ? "true" : "false") << ")"; break;
+    case NK_VAR: cout << "('" << Symbol(f.a) << "')"; break;
+    case NK_ARRAY_ACCESS: cout << ": " << Symbol(f.a); break;
+    case NK_BIN_OP: case NK_UNARY_OP: cout << "('" << Symbol(f.a) << "')"; break;
+    case NK_VAR_DECL: cout << "(name: '" << Symbol(ast.nameList(f.a)[0]) << "')"; break;
+    case NK_PROGRAM: case NK_CONST_DECL: case NK_TYPE_DECL: case NK_PROCEDURE_DECL:
+    case NK_FUNCTION_DECL: case NK_PROCEDURE_CALL:
+        cout << "(name: '" << Symbol(f.a) << "')";
+        break;
+    default: break;
     }
-    else if (node->nodeType == "ArrayType") {
-        ArrayTypeNode* atn = static_cast<ArrayTypeNode*>(node);
-        size_t childCount = (atn->rangeStart ? 1 : 0) + (atn->rangeEnd ? 1 : 0);
-        size_t count = 0;
-        
-        if (atn->rangeStart) {
-            count++;
-            printDecoratedAST(atn->rangeStart, newPrefix, count == childCount);
-        }
-        if (atn->rangeEnd) {
-            count++;
-            printDecoratedAST(atn->rangeEnd, newPrefix, count == childCount);
+}
+
+// One line per node with what the analysis attached to it, in one pass
+// over the flat layout. Parameters belong to their declaration's line and
+// a constant's value is not drawn.
+void SemanticAnalyzer::printDecoratedAST(const FlatAST& ast) {
+    struct Level {
+        uint32_t node, end;
+        size_t length;                      // of prefix before the node's indent
+    };
+    vector<Level> open;
+    string prefix;
+    for (uint32_t i = 0; i < ast.size(); i++) {
+        while (!open.empty() && open.back().end <= i) {
+            prefix.resize(open.back().length);
+            open.pop_back();
+        }
+        const FlatNode& f = ast.nodes[i];
+        if (f.kind == FK_EMPTY || f.kind == NK_PARAM) continue;
+        bool last = open.empty() || drawnLast(ast, open.back().node, i);
+
+        cout << prefix << (last ? "└── " : "├── ") << nodeKindName((NodeKind)f.kind);
+        describe(ast, f);
+        cout << " → ";
+
+        const FlatDecoration& d = ast.decorations[i];
+        if (d.symbolIndex >= 0) {
+            cout << "tab_index:" << d.symbolIndex;
+            if (d.symbolIndex < (int)tab.size()) cout << ", obj:" << getObjectName(tab[d.symbolIndex].obj);
+            cout << ", ";
+        }
+        if (!d.dataType.empty()) cout << "type:'" << d.dataType << "'";
+        else cout << "type:void";
+        if (d.scopeLevel >= 0) cout << ", lev:" << d.scopeLevel;
+        cout << endl;
+
+        if (f.kind == NK_CONST_DECL) {
+            i = f.end - 1;
+            continue;
+        }
+        if (ast.hasChildren(i)) {
+            open.push_back(Level{i, f.end, prefix.size()});
+            prefix += last ? "    " : "│   ";
         }
     }
 }
 
-void semanticAnalysis(ASTNode* ast) {
-    SemanticAnalyzer analyzer;
-    analyzer.analyze(ast);
-
+static void printDecoratedTree(SemanticAnalyzer& analyzer, ASTNode* ast) {
     cout << "\n========== Decorated AST ==========\n";
-    analyzer.printDecoratedAST(ast, "", true);
+    analyzer.printDecoratedAST(flattenAST(ast));
     cout << "===================================\n" << endl;
 }
 
+bool semanticAnalysis(ASTNode* ast) {
+    SemanticAnalyzer analyzer;
+    bool completed = analyzer.analyze(ast);
+    printDecoratedTree(analyzer, ast);
+    return completed;
+}
+
+void replaySemanticAnalysis(ASTNode* ast, bool completed) {
+    SemanticAnalyzer analyzer;
+    cout << ANALYSIS_STARTED;
+    if (completed) cout << ANALYSIS_COMPLETED;
+    printDecoratedTree(analyzer, ast);
+}
+
 void printSymbolTables() {
     printTab();
     printBtab();
@@ -6,6 +6,9 @@ using namespace std;
 
 vector<AtabEntry> atab;
 
+static const Symbol SYM_TRUE = intern("true");
+static const Symbol SYM_FALSE = intern("false");
+
 void semanticError(const string& message) {
     // cerr << "Semantic Error: " << message << endl;
     throw runtime_error(message);
@@ -29,43 +32,50 @@ string getTypeName(int typeCode) {
 int determineIndexType(ASTNode* node) {
     if (!node) return 0;
 
-    if (node->nodeType == "Number") return 1;
-    if (node->nodeType == "Real") return 2;
-    if (node->nodeType == "Boolean") return 3; 
-    if (node->nodeType == "Var") {
+    switch (node->kind) {
+    case NK_NUMBER: return 1;
+    case NK_REAL: return 2;
+    case NK_BOOLEAN: return 3;
+    case NK_VAR: {
         VarNode* v = static_cast<VarNode*>(node);
-        if (v->name == "true" || v->name == "false") return 3; // Boolean
+        if (v->name == SYM_TRUE || v->name == SYM_FALSE) return 3; // Boolean
+        return 0;
+    }
+    case NK_CHAR: return 4;
+    default: return 0;
     }
-    if (node->nodeType == "Char") return 4;    
-    
-    return 0; 
 }
 
 int getOrdinalValue(ASTNode* node) {
     if (!node) return 0;
 
-    if (node->nodeType == "Number") {
+    switch (node->kind) {
+    case NK_NUMBER: {
         return static_cast<NumberNode*>(node)->value;
     }
-    else if (node->nodeType == "Real") {
+    case NK_REAL: {
         RealNode* realNode = static_cast<RealNode*>(node);
         return static_cast<int>(realNode->value); 
-    }       
-    else if (node->nodeType == "Char") {
+    }
+    case NK_CHAR: {
         CharNode* charNode = static_cast<CharNode*>(node);
         return (int)charNode->value; 
     }
-    else if (node->nodeType == "Boolean") {
+    case NK_BOOLEAN: {
         BoolNode* boolNode = static_cast<BoolNode*>(node);
         return boolNode->value ? 1 : 0;
     }
-    else if (node->nodeType == "Var") {
+    case NK_VAR: {
         VarNode* varNode = static_cast<VarNode*>(node);
-        if (varNode->name == "true") return 1;
-        if (varNode->name == "false") return 0;
+        if (varNode->name == SYM_TRUE) return 1;
+        if (varNode->name == SYM_FALSE) return 0;
+        break;
+    }
+    default:
+        break;
     }
 
-    semanticError("Cannot determine ordinal value for node type: " + node->nodeType);
+    semanticError(string("Cannot determine ordinal value for node type: ") + nodeKindName(node->kind));
     return 0;
 }
 
@@ -85,6 +95,16 @@ int getTypeCode(const string& typeName) {
     return 0;
 }
 
+int getTypeCode(Symbol typeName) {
+    static const Symbol names[] = {
+        intern("integer"), intern("real"), intern("boolean"), intern("char"), intern("array")
+    };
+    for (int i = 0; i < 5; i++) {
+        if (names[i] == typeName) return i + 1;
+    }
+    return 0;
+}
+
 int getTypeSize(int typeCode) {
     switch(typeCode) {
         case 1: return 1; // integer
@@ -101,7 +121,7 @@ int getLowerBound(ASTNode* rangeStart) {
         return 0;
     }
     
-    if (rangeStart->nodeType == "Number") {
+    if (rangeStart->kind == NK_NUMBER) {
         NumberNode* numNode = static_cast<NumberNode*>(rangeStart);
         return numNode->value;
     }
@@ -116,7 +136,7 @@ int getUpperBound(ASTNode* rangeEnd) {
         return 0;
     }
     
-    if (rangeEnd->nodeType == "Number") {
+    if (rangeEnd->kind == NK_NUMBER) {
         NumberNode* numNode = static_cast<NumberNode*>(rangeEnd);
         return numNode->value;
     }
@@ -144,7 +164,7 @@ int processArrayDeclaration(ArrayTypeNode* arrayTypeNode) {
 
     if (startType != endType) {
         semanticError(
-            "Array index type mismatch in range [" + arrayTypeNode->elementType
+            "Array index type mismatch in range [" + arrayTypeNode->elementType.text()
             + "] (start type: " + getTypeName(startType)
             + ", end type: " + getTypeName(endType) + ")"
         );
@@ -166,7 +186,7 @@ int processArrayDeclaration(ArrayTypeNode* arrayTypeNode) {
     
     entry.etyp = getTypeCode(arrayTypeNode->elementType);
     if (entry.etyp == 0) {
-        semanticError("Invalid array element type: " + arrayTypeNode->elementType);
+        semanticError("Invalid array element type: " + arrayTypeNode->elementType.text());
         return -1;
     }
     
@@ -43,7 +43,7 @@ void initializeTab(){
     
     for (const string& kw : keywords) {
         TabEntry e;
-        e.name = kw;
+        e.name = intern(kw);
         e.link = 0;
         e.obj = 0;  
         e.type = 0;
@@ -57,7 +57,7 @@ void initializeTab(){
 
     {
         TabEntry e;
-        e.name = "false";
+        e.name = intern("false");
         e.link = 0;
         e.obj = OBJ_CONSTANT; 
         e.type = 3;           
@@ -68,7 +68,7 @@ void initializeTab(){
 
     {
         TabEntry e;
-        e.name = "true";
+        e.name = intern("true");
         e.link = 0;
         e.obj = OBJ_CONSTANT; 
         e.type = 3;           
@@ -87,7 +87,7 @@ void initializeTab(){
 
     for(const auto& t : types) {
         TabEntry e;
-        e.name = t.name;
+        e.name = intern(t.name);
         e.link = 0;
         e.obj = OBJ_TYPE;     
         e.type = t.typeCode;  
@@ -98,7 +98,7 @@ void initializeTab(){
 
 }
 
-bool isDuplicateInCurrentBlock(const string& name){
+bool isDuplicateInCurrentBlock(Symbol name){
     if(display.empty()) return false;
 
     int curLevel = currentLevel;
@@ -115,7 +115,7 @@ bool isDuplicateInCurrentBlock(const string& name){
     return false;
 }
 
-int insertIdentifier(const string& name, int obj, int type, int ref, int nrm, int adr){
+int insertIdentifier(Symbol name, int obj, int type, int ref, int nrm, int adr){
     initializeTab();
 
     if(display.empty()){
@@ -134,7 +134,7 @@ int insertIdentifier(const string& name, int obj, int type, int ref, int nrm, in
     int scan = head;
     while(scan !=0){
         if(tab[scan].name == name){
-            semanticError("Redeclaration of identifier '" + name + "' in the same block.");
+            semanticError("Redeclaration of identifier '" + name.text() + "' in the same block.");
             return scan;
         }
         scan = tab[scan].link;
@@ -159,7 +159,13 @@ int insertIdentifier(const string& name, int obj, int type, int ref, int nrm, in
     return newIndex;
 }
 
-int lookupIdentifier(const string& name){
+bool isBuiltinProcedure(Symbol name){
+    static const Symbol writeln = intern("writeln"), write = intern("write"),
+                        readln = intern("readln"), read = intern("read");
+    return name == writeln || name == write || name == readln || name == read;
+}
+
+int lookupIdentifier(Symbol name){
     for (int lv = currentLevel; lv >= 0; --lv) {
         if (lv >= (int)display.size()) continue;
         int block = display[lv];
@@ -178,7 +184,7 @@ int lookupIdentifier(const string& name){
         }
     }
 
-    if (name == "writeln" || name == "write" || name == "readln" || name == "read") {
+    if (isBuiltinProcedure(name)) {
         for(size_t i = 29; i < tab.size(); i++){
             if(tab[i].name == name && tab[i].nrm == 1 && tab[i].obj == OBJ_PROCEDURE){
                 return i;  
@@ -218,7 +224,7 @@ void printTab(){
     for (size_t i = 0; i < tab.size(); i++) {
         cout << i << "\t";
         
-        string name = tab[i].name;
+        string_view name = tab[i].name.str();
         if (name.length() < 16) {
             cout << name;
             for (size_t j = name.length(); j < 16; j++) cout << " ";
@@ -0,0 +1,14 @@
+program MissingOperand;
+variabel
+    data: integer;
+    daftar: larik[1 .. 5] dari integer;
+    i: integer;
+mulai
+    data := integer 999;
+    untuk i := ke 5 lakukan
+        daftar[i] := daftar[] + 1;
+    jika data > maka
+        data := 0;
+    daftar[1] := data * ;
+    data := ('c'+)
+selesai.
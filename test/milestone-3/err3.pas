@@ -0,0 +1,5208 @@
+program ManySubprograms;
+variabel
+    g: integer;
+prosedur p0(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p1(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p2(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p3(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p4(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p5(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p6(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p7(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p8(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p9(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p10(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p11(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p12(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p13(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p14(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p15(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p16(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p17(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p18(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p19(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p20(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p21(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p22(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p23(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p24(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p25(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p26(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p27(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p28(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p29(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p30(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p31(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p32(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p33(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p34(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p35(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p36(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p37(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p38(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p39(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p40(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p41(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p42(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p43(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p44(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p45(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p46(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p47(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p48(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p49(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p50(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p51(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p52(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p53(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p54(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p55(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p56(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p57(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p58(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p59(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p60(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p61(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p62(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p63(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p64(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p65(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p66(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p67(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p68(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p69(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p70(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p71(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p72(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p73(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p74(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p75(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p76(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p77(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p78(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p79(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p80(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p81(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p82(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p83(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p84(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p85(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p86(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p87(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p88(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p89(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p90(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p91(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p92(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p93(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p94(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p95(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p96(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p97(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p98(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p99(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p100(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p101(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p102(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p103(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p104(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p105(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p106(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p107(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p108(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p109(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p110(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p111(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p112(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p113(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p114(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p115(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p116(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p117(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p118(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p119(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p120(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p121(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p122(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p123(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p124(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p125(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p126(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p127(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p128(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p129(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p130(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p131(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p132(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p133(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p134(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p135(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p136(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p137(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p138(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p139(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p140(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p141(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p142(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p143(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p144(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p145(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p146(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p147(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p148(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p149(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p150(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p151(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p152(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p153(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p154(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p155(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p156(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p157(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p158(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p159(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p160(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p161(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p162(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p163(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p164(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p165(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p166(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p167(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p168(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p169(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p170(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p171(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p172(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p173(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p174(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p175(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p176(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p177(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p178(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p179(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p180(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p181(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p182(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p183(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p184(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p185(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p186(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p187(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p188(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p189(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p190(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p191(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p192(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p193(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p194(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p195(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p196(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p197(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p198(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p199(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p200(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p201(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p202(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p203(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p204(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p205(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p206(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p207(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p208(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p209(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p210(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p211(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p212(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p213(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p214(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p215(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p216(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p217(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p218(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p219(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p220(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p221(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p222(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p223(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p224(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p225(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p226(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p227(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p228(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p229(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p230(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p231(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p232(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p233(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p234(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p235(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p236(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p237(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p238(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p239(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p240(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p241(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p242(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p243(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p244(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p245(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p246(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p247(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p248(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p249(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p250(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p251(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p252(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p253(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p254(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p255(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p256(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p257(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p258(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p259(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p260(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p261(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p262(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p263(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p264(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p265(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p266(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p267(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p268(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p269(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p270(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p271(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p272(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p273(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p274(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p275(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p276(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p277(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p278(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p279(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p280(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p281(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p282(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p283(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p284(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p285(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p286(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p287(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p288(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p289(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p290(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p291(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p292(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p293(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p294(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p295(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p296(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p297(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p298(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p299(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p300(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p301(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p302(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p303(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p304(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p305(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p306(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p307(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p308(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p309(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p310(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p311(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p312(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p313(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p314(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p315(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p316(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p317(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p318(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p319(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p320(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p321(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p322(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p323(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p324(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p325(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p326(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p327(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p328(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p329(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p330(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p331(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p332(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p333(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p334(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p335(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p336(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p337(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p338(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p339(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p340(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p341(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p342(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p343(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p344(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p345(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p346(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p347(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p348(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p349(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p350(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p351(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p352(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p353(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p354(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p355(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p356(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p357(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p358(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p359(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p360(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p361(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p362(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p363(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p364(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p365(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p366(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p367(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p368(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p369(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p370(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p371(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p372(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p373(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p374(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p375(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p376(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p377(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p378(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p379(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p380(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p381(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p382(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p383(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p384(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p385(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p386(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p387(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p388(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p389(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p390(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + ; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p391(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p392(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p393(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p394(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p395(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p396(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p397(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p398(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+prosedur p399(y: integer);
+variabel
+    x: integer;
+mulai
+    x := 0;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    x := x + y; x := x + y; x := x + y; x := x + y; x := x + y;
+    writeln(x)
+selesai;
+mulai
+    g := 1;
+    p0(g);
+    p399(g)
+selesai.
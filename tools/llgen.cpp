@@ -0,0 +1,476 @@
+// Grammar compiler: turns the EBNF grammar (src/parser/pascal-s.ebnf) into
+// a header of LL(1) parse tables for the table-driven parser. Repetitions,
+// options and groups become helper nonterminals that make no parse node.
+// Cells that one token cannot decide list the second tokens instead; the
+// earlier alternative wins, and clashes between concrete second tokens are
+// reported.
+//
+// Usage: llgen <grammar.ebnf> <output.hpp>
+
+#include "token.hpp"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+const int NUM_TERMINALS = TK_COUNT + KW_COUNT + OP_COUNT;
+const int NONE = -1;                    // no second token / empty string
+
+// ========== Grammar file ==========
+
+enum ExprKind { E_TERMINAL, E_RULE, E_SEQ, E_ALT, E_OPT, E_REP };
+
+struct Expr {
+    ExprKind kind;
+    int terminal = 0;
+    string name;                        // E_RULE
+    vector<Expr> items;
+};
+
+struct Rule {
+    string name;
+    string node;                        // RuleKind suffix, empty for helpers
+    Expr body;
+};
+
+struct GrammarReader {
+    string text;
+    size_t pos = 0;
+    int line = 1;
+    bool failed = false;
+
+    void fail(const string &message) {
+        if (!failed) cerr << "grammar:" << line << ": " << message << "\n";
+        failed = true;
+        pos = text.size();
+    }
+
+    void skipSpace() {
+        while (pos < text.size()) {
+            if (text[pos] == '#') {
+                while (pos < text.size() && text[pos] != '\n') pos++;
+            } else if (isspace((unsigned char)text[pos])) {
+                if (text[pos] == '\n') line++;
+                pos++;
+            } else {
+                break;
+            }
+        }
+    }
+
+    char peekChar() {
+        skipSpace();
+        return pos < text.size() ? text[pos] : '\0';
+    }
+
+    bool accept(char c) {
+        if (peekChar() != c) return false;
+        pos++;
+        return true;
+    }
+
+    void expect(char c) {
+        if (!accept(c)) fail(string("expected '") + c + "'");
+    }
+
+    string word() {
+        skipSpace();
+        size_t start = pos;
+        while (pos < text.size() && (isalnum((unsigned char)text[pos]) || text[pos] == '_')) pos++;
+        if (start == pos) fail("expected a name");
+        return text.substr(start, pos - start);
+    }
+
+    // item → WORD | 'quoted' | ( alt ) | [ alt ] | { alt }
+    bool item(Expr &out) {
+        char c = peekChar();
+        if (c == '(' || c == '[' || c == '{') {
+            pos++;
+            Expr inner = alternatives();
+            expect(c == '(' ? ')' : c == '[' ? ']' : '}');
+            if (c == '(') out = inner;
+            else out = Expr{c == '[' ? E_OPT : E_REP, 0, "", {inner}};
+            return true;
+        }
+        if (c == '\'') {
+            size_t end = text.find('\'', ++pos);
+            if (end == string::npos) { fail("unterminated quote"); return false; }
+            string spelling = text.substr(pos, end - pos);
+            pos = end + 1;
+            if (Keyword kw = keywordFromName(spelling)) out = Expr{E_TERMINAL, TK_COUNT + kw, "", {}};
+            else if (Operator op = operatorFromName(spelling)) out = Expr{E_TERMINAL, TK_COUNT + KW_COUNT + op, "", {}};
+            else fail("'" + spelling + "' is neither a keyword nor an operator");
+            return true;
+        }
+        if (isalpha((unsigned char)c) || c == '_') {
+            string name = word();
+            if (TokenKind kind = tokenKindFromName(name)) out = Expr{E_TERMINAL, kind, "", {}};
+            else out = Expr{E_RULE, 0, name, {}};
+            return true;
+        }
+        return false;
+    }
+
+    Expr sequence() {
+        Expr seq{E_SEQ, 0, "", {}};
+        Expr next;
+        while (!failed && item(next)) seq.items.push_back(next);
+        return seq;
+    }
+
+    Expr alternatives() {
+        Expr alt{E_ALT, 0, "", {sequence()}};
+        while (!failed && accept('|')) alt.items.push_back(sequence());
+        return alt.items.size() == 1 ? alt.items[0] : alt;
+    }
+
+    // rule → WORD [as WORD] = alt ;
+    bool rules(vector<Rule> &out) {
+        while (!failed && peekChar()) {
+            Rule rule;
+            rule.name = word();
+            rule.node = rule.name[0] == '_' ? "" : rule.name;
+            if (peekChar() == 'a') {
+                if (word() != "as") fail("expected 'as' or '='");
+                rule.node = word();
+            }
+            expect('=');
+            rule.body = alternatives();
+            expect(';');
+            if (!failed) out.push_back(rule);
+        }
+        return !failed;
+    }
+};
+
+// ========== Lowering to BNF ==========
+
+// Symbols: terminals as is, nonterminal n as -1 - n
+struct Grammar {
+    vector<string> ntName;
+    vector<string> ntNode;              // "" for helpers
+    vector<vector<int>> ntProds;
+    vector<int> prodLhs;
+    vector<vector<int>> prodRhs;
+    map<string, int> ruleIndex;
+    bool failed = false;
+
+    int addNonterminal(const string &name, const string &node) {
+        ntName.push_back(name);
+        ntNode.push_back(node);
+        ntProds.emplace_back();
+        return (int)ntName.size() - 1;
+    }
+
+    void addProduction(int nt, vector<int> rhs) {
+        ntProds[nt].push_back((int)prodRhs.size());
+        prodLhs.push_back(nt);
+        prodRhs.push_back(move(rhs));
+    }
+
+    static vector<const Expr *> alternativesOf(const Expr &e) {
+        vector<const Expr *> alts;
+        if (e.kind == E_ALT) for (auto &a : e.items) alts.push_back(&a);
+        else alts.push_back(&e);
+        return alts;
+    }
+
+    // Appends the symbols for e, making helpers for options, repetitions
+    // and nested alternatives
+    void lower(const Expr &e, const string &owner, vector<int> &out) {
+        switch (e.kind) {
+        case E_TERMINAL:
+            out.push_back(e.terminal);
+            break;
+        case E_RULE: {
+            auto it = ruleIndex.find(e.name);
+            if (it == ruleIndex.end()) {
+                cerr << "grammar: unknown rule '" << e.name << "' in " << owner << "\n";
+                failed = true;
+                return;
+            }
+            out.push_back(-1 - it->second);
+            break;
+        }
+        case E_SEQ:
+            for (auto &item : e.items) lower(item, owner, out);
+            break;
+        case E_ALT:
+        case E_OPT:
+        case E_REP: {
+            int helper = addNonterminal(owner + "." + to_string(ntName.size()), "");
+            const Expr &body = e.kind == E_ALT ? e : e.items[0];
+            for (const Expr *alt : alternativesOf(body)) {
+                vector<int> rhs;
+                lower(*alt, owner, rhs);
+                if (e.kind == E_REP) rhs.push_back(-1 - helper);
+                addProduction(helper, rhs);
+            }
+            if (e.kind != E_ALT) addProduction(helper, {});
+            out.push_back(-1 - helper);
+            break;
+        }
+        }
+    }
+
+    bool build(const vector<Rule> &rules) {
+        for (auto &r : rules) {
+            if (ruleIndex.count(r.name)) {
+                cerr << "grammar: rule '" << r.name << "' defined twice\n";
+                return false;
+            }
+            ruleIndex[r.name] = addNonterminal(r.name, r.node);
+        }
+        for (auto &r : rules) {
+            int nt = ruleIndex[r.name];
+            for (const Expr *alt : alternativesOf(r.body)) {
+                vector<int> rhs;
+                lower(*alt, r.name, rhs);
+                addProduction(nt, rhs);
+            }
+        }
+        return !failed;
+    }
+};
+
+// ========== FIRST / FOLLOW ==========
+
+typedef pair<int, int> Prefix;          // up to two terminals, NONE-padded
+
+struct Analysis {
+    const Grammar &g;
+    size_t numNT;
+    vector<char> nullable;
+    vector<set<int>> first, follow;
+    vector<set<Prefix>> first2;
+
+    explicit Analysis(const Grammar &g) : g(g), numNT(g.ntName.size()),
+        nullable(numNT, 0), first(numNT), follow(numNT), first2(numNT) {}
+
+    bool seqNullable(const vector<int> &rhs, size_t from = 0) const {
+        for (size_t i = from; i < rhs.size(); ++i)
+            if (rhs[i] >= 0 || !nullable[-1 - rhs[i]]) return false;
+        return true;
+    }
+
+    set<int> seqFirst(const vector<int> &rhs, size_t from = 0) const {
+        set<int> out;
+        for (size_t i = from; i < rhs.size(); ++i) {
+            if (rhs[i] >= 0) { out.insert(rhs[i]); break; }
+            auto &f = first[-1 - rhs[i]];
+            out.insert(f.begin(), f.end());
+            if (!nullable[-1 - rhs[i]]) break;
+        }
+        return out;
+    }
+
+    static set<Prefix> concat(const set<Prefix> &a, const set<Prefix> &b) {
+        set<Prefix> out;
+        for (auto &x : a) {
+            if (x.second != NONE) out.insert(x);
+            else if (x.first != NONE) for (auto &y : b) out.insert({x.first, y.first});
+            else out.insert(b.begin(), b.end());
+        }
+        return out;
+    }
+
+    set<Prefix> seqFirst2(const vector<int> &rhs) const {
+        set<Prefix> out = {{NONE, NONE}};
+        for (int s : rhs) out = concat(out, s >= 0 ? set<Prefix>{{s, NONE}} : first2[-1 - s]);
+        return out;
+    }
+
+    void run() {
+        for (bool changed = true; changed;) {
+            changed = false;
+            for (size_t p = 0; p < g.prodRhs.size(); ++p) {
+                int a = g.prodLhs[p];
+                auto &rhs = g.prodRhs[p];
+                if (!nullable[a] && seqNullable(rhs)) nullable[a] = changed = true;
+                for (int t : seqFirst(rhs)) changed |= first[a].insert(t).second;
+                for (auto &x : seqFirst2(rhs)) changed |= first2[a].insert(x).second;
+            }
+        }
+        follow[0].insert(TK_EOF);
+        for (bool changed = true; changed;) {
+            changed = false;
+            for (size_t p = 0; p < g.prodRhs.size(); ++p) {
+                auto &rhs = g.prodRhs[p];
+                for (size_t i = 0; i < rhs.size(); ++i) {
+                    if (rhs[i] >= 0) continue;
+                    auto &f = follow[-1 - rhs[i]];
+                    for (int t : seqFirst(rhs, i + 1)) changed |= f.insert(t).second;
+                    if (seqNullable(rhs, i + 1))
+                        for (int t : follow[g.prodLhs[p]]) changed |= f.insert(t).second;
+                }
+            }
+        }
+    }
+
+    // Two-token prefixes production p can start with, FOLLOW-padded
+    set<Prefix> predict2(int p) const {
+        set<Prefix> tail;
+        for (int t : follow[g.prodLhs[p]]) tail.insert({t, NONE});
+        return concat(seqFirst2(g.prodRhs[p]), tail);
+    }
+};
+
+// ========== Output ==========
+
+static string terminalName(int t) {
+    if (t < TK_COUNT) return tokenKindName((TokenKind)t);
+    if (t < TK_COUNT + KW_COUNT) return string("'") + keywordName((Keyword)(t - TK_COUNT)) + "'";
+    return string("'") + operatorName((Operator)(t - TK_COUNT - KW_COUNT)) + "'";
+}
+
+static string upper(string s) {
+    for (char &c : s) c = (char)toupper((unsigned char)c);
+    return s;
+}
+
+template <typename T>
+static void emitArray(ostream &out, const string &decl, const vector<T> &values) {
+    out << "constexpr " << decl << " = {";
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (i % 16 == 0) out << "\n    ";
+        out << (long)values[i] << (i + 1 < values.size() ? "," : "");
+    }
+    out << "\n};\n\n";
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        cerr << "Usage: " << argv[0] << " <grammar.ebnf> <output.hpp>\n";
+        return 1;
+    }
+
+    ifstream in(argv[1]);
+    if (!in) {
+        cerr << "Cannot open " << argv[1] << "\n";
+        return 1;
+    }
+    GrammarReader reader;
+    reader.text.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+    vector<Rule> rules;
+    if (!reader.rules(rules)) return 1;
+    if (rules.empty()) {
+        cerr << "grammar: no rules\n";
+        return 1;
+    }
+
+    Grammar g;
+    if (!g.build(rules)) return 1;
+    Analysis an(g);
+    an.run();
+
+    // Prediction table; ambiguous cells go through the second token
+    const size_t numNT = g.ntName.size();
+    vector<int16_t> table(numNT * NUM_TERMINALS, -1);
+    vector<int16_t> second;
+    bool clash = false;
+    for (size_t a = 0; a < numNT; ++a) {
+        map<int, vector<int>> cells;
+        for (int p : g.ntProds[a]) {
+            set<int> predict = an.seqFirst(g.prodRhs[p]);
+            if (an.seqNullable(g.prodRhs[p])) predict.insert(an.follow[a].begin(), an.follow[a].end());
+            for (int t : predict) cells[t].push_back(p);
+        }
+        for (auto &cell : cells) {
+            int t = cell.first;
+            if (cell.second.size() == 1) {
+                table[a * NUM_TERMINALS + t] = (int16_t)cell.second[0];
+                continue;
+            }
+            table[a * NUM_TERMINALS + t] = (int16_t)(-2 - (int)second.size());
+            set<int> claimed;
+            bool any = false;
+            for (int p : cell.second) {
+                for (auto &x : an.predict2(p)) {
+                    if (x.first != t) continue;
+                    if (any || claimed.count(x.second)) {
+                        cerr << "grammar: " << g.ntName[a] << " on " << terminalName(t)
+                             << (x.second == NONE ? "" : " " + terminalName(x.second))
+                             << " is ambiguous, taking the earlier alternative\n";
+                        clash = true;
+                        continue;
+                    }
+                    if (x.second == NONE) continue;
+                    claimed.insert(x.second);
+                    second.push_back((int16_t)x.second);
+                    second.push_back((int16_t)p);
+                }
+                // One token then anything: the default for this cell
+                if (!any && an.predict2(p).count({t, NONE})) {
+                    any = true;
+                    second.push_back(NONE);
+                    second.push_back((int16_t)p);
+                }
+            }
+            second.push_back(-2);
+            second.push_back(-1);
+        }
+    }
+    if (clash) cerr << "grammar: ambiguities above are resolved by alternative order\n";
+
+    vector<int16_t> rhs;
+    vector<uint16_t> rhsStart;
+    for (auto &r : g.prodRhs) {
+        rhsStart.push_back((uint16_t)rhs.size());
+        for (int s : r) rhs.push_back((int16_t)s);
+    }
+    rhsStart.push_back((uint16_t)rhs.size());
+
+    ostringstream out;
+    out << "// Generated by tools/llgen from " << argv[1] << ". Do not edit.\n"
+        << "#ifndef GRAMMAR_GEN_HPP\n#define GRAMMAR_GEN_HPP\n\n"
+        << "#include <cstdint>\n#include \"parser.hpp\"\n\n"
+        << "// Terminal ids: token kind, TK_COUNT + keyword, TK_COUNT + KW_COUNT + operator\n"
+        << "constexpr int LL_TERMINALS = " << NUM_TERMINALS << ";\n"
+        << "constexpr int LL_NONTERMINALS = " << numNT << ";\n"
+        << "constexpr int LL_PRODUCTIONS = " << g.prodRhs.size() << ";\n"
+        << "static_assert(LL_TERMINALS == TK_COUNT + KW_COUNT + OP_COUNT, \"token enums changed, rerun llgen\");\n\n";
+
+    out << "// Right-hand sides back to back; terminals as is, nonterminal n as -1 - n\n";
+    emitArray(out, "int16_t LL_RHS[]", rhs);
+    emitArray(out, "uint16_t LL_RHS_START[LL_PRODUCTIONS + 1]", rhsStart);
+
+    out << "// Parse node per nonterminal, RK_COUNT for helpers that make none\n"
+        << "constexpr RuleKind LL_NODE_KIND[LL_NONTERMINALS] = {";
+    for (size_t a = 0; a < numNT; ++a)
+        out << "\n    " << (g.ntNode[a].empty() ? "RK_COUNT" : "RK_" + upper(g.ntNode[a]))
+            << (a + 1 < numNT ? "," : "") << "   // " << g.ntName[a];
+    out << "\n};\n\n";
+
+    out << "// [nonterminal][terminal]: production, -1 for a syntax error, or -2 - i\n"
+        << "// to pick by the second token from LL_SECOND[i] on\n"
+        << "constexpr int16_t LL_TABLE[LL_NONTERMINALS * LL_TERMINALS] = {";
+    for (size_t a = 0; a < numNT; ++a) {
+        out << "\n    // " << g.ntName[a];
+        for (int t = 0; t < NUM_TERMINALS; ++t) {
+            if (t % 16 == 0) out << "\n    ";
+            out << table[a * NUM_TERMINALS + t] << (a + 1 < numNT || t + 1 < NUM_TERMINALS ? "," : "");
+        }
+    }
+    out << "\n};\n\n";
+
+    out << "// (second terminal or -1 for any, production) pairs; a run ends at -2\n";
+    emitArray(out, "int16_t LL_SECOND[]", second);
+    out << "#endif\n";
+
+    ofstream file(argv[2]);
+    if (!file) {
+        cerr << "Cannot write " << argv[2] << "\n";
+        return 1;
+    }
+    file << out.str();
+    cerr << "Grammar: " << numNT << " nonterminals, " << g.prodRhs.size() << " productions, "
+         << second.size() / 2 << " second-token entries\n";
+    return 0;
+}
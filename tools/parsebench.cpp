@@ -0,0 +1,81 @@
+// Parser benchmark: builds the parse tree of one file with the
+// recursive-descent parser and with the table-driven one, checks that the
+// trees match and reports the time per parse. Tokens are lexed once up
+// front and replayed, so only parsing is timed.
+//
+// Usage: parsebench <source.pas> [iterations]
+
+#include "table_parser.hpp"
+#include "dfa.hpp"
+#include "source.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+using namespace std;
+
+static bool sameTree(const ParseNode *a, const ParseNode *b) {
+    if (a->rule != b->rule || a->tok.kind != b->tok.kind || a->tok.offset != b->tok.offset ||
+        a->children.size() != b->children.size())
+        return false;
+    for (size_t i = 0; i < a->children.size(); ++i)
+        if (!sameTree(a->children[i], b->children[i])) return false;
+    return true;
+}
+
+template <class Parse>
+static double timePerParse(const Lexer &base, const vector<Token> &tokens, int iterations, Parse parse) {
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        Lexer replay(base, tokens);
+        Arena arena;
+        parse(replay, arena);
+    }
+    chrono::duration<double, micro> elapsed = chrono::steady_clock::now() - start;
+    return elapsed.count() / iterations;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        cerr << "Usage: " << argv[0] << " <source.pas> [iterations]\n";
+        return 1;
+    }
+    int iterations = argc > 2 ? atoi(argv[2]) : 2000;
+    if (iterations < 1) iterations = 1;
+
+    LexerRules rules = builtinRules();
+    SourceFile source;
+    if (!source.open(argv[1])) { cerr << "Cannot open file\n"; return 1; }
+    Lexer base(source.text(), rules, nullptr);
+    vector<Token> tokens = runDFA(source.text(), rules, nullptr);
+
+    // One checked parse each; the table parser gives up on syntax errors
+    ostringstream quiet;
+    Lexer lexA(base, tokens), lexB(base, tokens);
+    Arena arenaA, arenaB;
+    Parser descent(lexA, arenaA, false, quiet);
+    ParseNode *expected = descent.parse();
+    ParseNode *actual = TableParser(lexB, arenaB).parse();
+    if (!expected || descent.errorCount() > 0) {
+        cerr << argv[1] << ": syntax error, nothing to compare\n";
+        return 1;
+    }
+    if (!actual || !sameTree(expected, actual)) {
+        cerr << argv[1] << ": parse trees differ\n";
+        return 1;
+    }
+
+    double rd = timePerParse(base, tokens, iterations, [](Lexer &lex, Arena &arena) {
+        ostringstream diag;
+        Parser(lex, arena, false, diag).parse();
+    });
+    double ll = timePerParse(base, tokens, iterations, [](Lexer &lex, Arena &arena) {
+        TableParser(lex, arena).parse();
+    });
+
+    cout << argv[1] << ": " << tokens.size() << " tokens, " << iterations << " iterations, trees match\n"
+         << "  recursive descent: " << rd << " us/parse\n"
+         << "  table-driven:      " << ll << " us/parse\n";
+    return 0;
+}
@@ -0,0 +1,113 @@
+// Rule compiler: turns rule.json into a header of constexpr lexer tables,
+// so the compiler binary starts without reading or parsing any JSON.
+//
+// Usage: rulec <rule.json> <output.hpp>
+
+#include "dfa.hpp"
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+using namespace std;
+
+static string quote(const string &s) {
+    string out = "\"";
+    for (char c : s) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out + "\"";
+}
+
+template <typename T>
+static void emitArray(ostream &out, const string &decl, const vector<T> &values) {
+    out << "constexpr " << decl << " = {";
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (i % 16 == 0) out << "\n    ";
+        out << (long)values[i] << (i + 1 < values.size() ? "," : "");
+    }
+    out << "\n};\n\n";
+}
+
+static void emitStrings(ostream &out, const string &name, const vector<string> &values) {
+    out << "constexpr const char *" << name << "[] = {";
+    for (size_t i = 0; i < values.size(); ++i) {
+        out << "\n    " << quote(values[i]) << (i + 1 < values.size() ? "," : "");
+    }
+    if (values.empty()) out << "\n    nullptr";
+    out << "\n};\n";
+    out << "constexpr int " << name << "_COUNT = " << values.size() << ";\n\n";
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        cerr << "Usage: " << argv[0] << " <rule.json> <output.hpp>\n";
+        return 1;
+    }
+
+    LexerRules rules;
+    DFAStats stats;
+    if (!loadRulesFile(argv[1], rules, &stats)) return 1;
+    const DFATable &dfa = rules.dfa;
+
+    // Bytes with identical columns share a class, so the shipped table is
+    // [state][class] and gets expanded back to [state][byte] at startup
+    vector<uint8_t> byteClass(256);
+    vector<int16_t> classNext;
+    int numClasses = 0;
+    {
+        map<vector<int16_t>, int> columnClass;
+        vector<vector<int16_t>> columns;
+        for (int b = 0; b < 256; ++b) {
+            vector<int16_t> col(dfa.numStates);
+            for (int st = 0; st < dfa.numStates; ++st) col[st] = (int16_t)dfa.step(st, (unsigned char)b);
+            auto it = columnClass.find(col);
+            if (it == columnClass.end()) {
+                it = columnClass.emplace(col, numClasses++).first;
+                columns.push_back(col);
+            }
+            byteClass[b] = (uint8_t)it->second;
+        }
+        classNext.resize((size_t)dfa.numStates * numClasses);
+        for (int st = 0; st < dfa.numStates; ++st)
+            for (int k = 0; k < numClasses; ++k) classNext[(size_t)st * numClasses + k] = columns[k][st];
+    }
+
+    ostringstream out;
+    out << "// Generated by tools/rulec from " << argv[1] << ". Do not edit.\n"
+        << "#ifndef RULES_GEN_HPP\n#define RULES_GEN_HPP\n\n"
+        << "#include <cstdint>\n\n"
+        << "namespace rules_gen {\n\n"
+        << "constexpr int NUM_STATES = " << dfa.numStates << ";\n"
+        << "constexpr int START_STATE = " << dfa.startState << ";\n"
+        << "constexpr int IDENTIFIER_STATE = " << dfa.identifierState << ";\n"
+        << "constexpr int ERROR_STATE = " << dfa.errorState << ";\n"
+        << "constexpr int NUM_CLASSES = " << numClasses << ";\n\n";
+
+    emitArray(out, "uint8_t BYTE_CLASS[256]", byteClass);
+    emitArray(out, "int16_t NEXT[NUM_STATES * NUM_CLASSES]", classNext);
+    emitArray(out, "uint8_t IS_FINAL[NUM_STATES]", dfa.isFinal);
+    emitArray(out, "uint8_t SKIP_IN_START[256]", vector<uint8_t>(dfa.skipInStart, dfa.skipInStart + 256));
+    emitStrings(out, "STATE_NAMES", dfa.stateNames);
+    emitArray(out, "uint8_t TOKEN_KIND[NUM_STATES]", dfa.tokenKind);
+
+    // Perfect-hash keyword table, see KeywordTable::classify
+    out << "constexpr uint32_t KEYWORD_SEED = " << rules.words.seed << ";\n"
+        << "constexpr int KEYWORD_SLOTS = " << rules.words.mask + 1 << ";\n\n";
+    emitStrings(out, "KEYWORD_WORDS", rules.words.words);
+    emitArray(out, "uint8_t KEYWORD_CLASS[KEYWORD_SLOTS]", rules.words.classes);
+    emitArray(out, "uint8_t KEYWORD_SUB[KEYWORD_SLOTS]", rules.words.subs);
+
+    out << "} // namespace rules_gen\n\n#endif\n";
+
+    ofstream f(argv[2]);
+    if (!f) {
+        cerr << "Error: cannot write " << argv[2] << "\n";
+        return 1;
+    }
+    f << out.str();
+    cout << "rulec: " << stats.statesBefore << " states, " << stats.statesReachable << " reachable, "
+         << stats.statesAfter << " after minimization, " << numClasses << " byte classes -> " << argv[2] << "\n";
+    return 0;
+}